@@ -0,0 +1,56 @@
+#include <rayflex.hpp>
+#include <iostream>
+
+using namespace rf;
+
+class Game : public core::State
+{
+  public:
+    core::RandomGenerator gen = core::RandomGenerator(1234);
+    std::vector<std::pair<raylib::Vector2, raylib::Vector2>> balls;
+
+  public:
+    void Enter() override
+    {
+        balls.resize(10000);
+        for (auto& [position, velocity] : balls)
+        {
+            position = gen.RandomVec2({ 0, 0 }, { 800, 600 });
+            velocity = gen.RandomVec2({ -200, -200 }, { 200, 200 });
+        }
+    }
+
+    void Update(float dt) override
+    {
+        for (auto& [position, velocity] : balls)
+        {
+            position += velocity * dt;
+            if (position.x < 0 || position.x > 800) velocity.x = -velocity.x;
+            if (position.y < 0 || position.y > 600) velocity.y = -velocity.y;
+        }
+    }
+
+    void Draw(const core::Renderer& target) override
+    {
+        target.Clear();
+        for (const auto& ball : balls)
+        {
+            DrawRectangleV(ball.first, { 2, 2 }, WHITE);
+        }
+    }
+};
+
+int main(int argc, char** argv)
+{
+    // Hidden window: falls back to headless mode if no display is available
+    core::App app("Core - Benchmark", 800, 600, FLAG_WINDOW_HIDDEN, false);
+    app.AddState<Game>("game");
+
+    const core::BenchmarkReport report = app.Benchmark("game", 1000, 1.0f / 60.0f,
+        app.IsHeadless() ? core::BenchmarkMode::NoDraw : core::BenchmarkMode::Offscreen);
+
+    if (argc > 1) report.Save(argv[1]);
+    else std::cout << report.ToJSON();
+
+    return 0;
+}
@@ -4,22 +4,19 @@ using namespace rf;
 
 class Loading : public core::LoadingState
 {
-  public:
-    float progress;
-
   public:
     void Task() override
     {
-        progress = 0.0f;
-        while (progress < 1.0f)
+        // Simulates independent loads of different costs executed in parallel
+        for (int i = 1; i <= 16; i++)
         {
-            progress += GetFrameTime() * 0.25f;
-            WaitTime(GetFrameTime());
+            AddJob([i]() { WaitTime(0.1 * i); }, nullptr, static_cast<float>(i));
         }
     }
 
     void Draw(const core::Renderer& target) override
     {
+        const float progress = GetProgress();
         raylib::Color(WHITE).DrawText("Loading...", 100, 100, 32);
         DrawCircleSector({ 400, 300 }, 32, 0, 360 * progress, 36, raylib::Color(Vector3{360 * progress, 1.0f, 1.0f}));
         DrawCircleSectorLines({ 400, 300 }, 64, 0, 360 * progress, 36, raylib::Color(Vector3{360 * progress, 1.0f, 1.0f}));
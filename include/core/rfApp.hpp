@@ -3,6 +3,17 @@
 
 #include "./rfCursor.hpp"
 #include "./rfRenderer.hpp"
+#include "./rfPostProcessChain.hpp"
+#include "./rfRenderBuffer.hpp"
+#include "./rfRenderTargetPool.hpp"
+#include "./rfProfiler.hpp"
+#include "./rfBenchmark.hpp"
+#include "./rfFrameLimiter.hpp"
+#include "./rfFrameArena.hpp"
+#include "./rfFrameCapture.hpp"
+#include "./rfMemoryTracker.hpp"
+#include "./rfJobSystem.hpp"
+#include "./rfCommandQueue.hpp"
 #include "./rfSaveManager.hpp"
 #include "./rfAssetManager.hpp"
 #include "./rfMusicManager.hpp"
@@ -13,10 +24,14 @@
 #include <Shader.hpp>
 
 #include <unordered_map>
+#include <functional>
 #include <utility>
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <limits>
+#include <deque>
+#include <mutex>
 
 namespace rf { namespace core {
 
@@ -59,16 +74,47 @@ namespace rf { namespace core {
 
         /**
          * @brief Updates the state logic.
+         *        When the App is pipelined (see core::App::SetPipelined()), it runs on a worker thread concurrently
+         *        with Draw() of the previous frame, and must not use the GL context nor data read by Draw().
+         *        The AssetManager can then only be used for lookups, evicted assets are reloaded by the main thread.
          * @param dt Delta time since the last frame.
          */
         virtual void Update(float dt)
         { }
 
+        /**
+         * @brief Updates the state simulation at a fixed rate.
+         *        Only called when the fixed timestep mode is enabled with core::App::SetFixedTimestep().
+         * @param step Fixed delta time of a simulation step (1/tickRate).
+         */
+        virtual void FixedUpdate(float step)
+        { }
+
         /**
          * @brief Draws the state content.
          */
         virtual void Draw(const Renderer& target)
         { }
+
+        /**
+         * @brief Draws the state content with the interpolation factor of the fixed timestep.
+         *        By default this simply calls Draw(target), override it to interpolate
+         *        between the two last simulation steps.
+         * @param target The renderer in which the state is drawn.
+         * @param alpha Interpolation factor between the previous and current fixed step (0 to 1),
+         *              always 1 when the fixed timestep mode is disabled.
+         */
+        virtual void Draw(const Renderer& target, float alpha)
+        {
+            Draw(target);
+        }
+
+        /**
+         * @brief Publishes the render data produced by Update() for Draw() (e.g. with core::RenderBuffer::Swap()).
+         *        Called on the main thread after each Update(), while neither Update() nor Draw() is running.
+         */
+        virtual void Sync()
+        { }
     };
 
     /**
@@ -77,22 +123,78 @@ namespace rf { namespace core {
      */
     class LoadingState : public State
     {
+      private:
+        friend class App;
+
+        using Finalizer = std::pair<std::function<void()>, float>;
+
+        mutable std::mutex jobsMutex;       ///< Protects the finalizers queue and the progress weights.
+        std::deque<Finalizer> finalizers;   ///< Main thread finalizations of the completed jobs, with their weights.
+        JobCounter jobsCounter;             ///< Counter of the jobs submitted with AddJob().
+        float totalWeight = 0.0f;           ///< Sum of the weights of all the submitted jobs.
+        float doneWeight = 0.0f;            ///< Sum of the weights of the fully completed jobs.
+
+      private:
+        /**
+         * @brief Checks if all the jobs and their finalizations are done.
+         */
+        bool IsJobsDone() const;
+
+        /**
+         * @brief Executes the pending finalizations on the calling (main) thread within the given budget.
+         *        At least one finalization is executed per call if any is pending.
+         * @param budget The time budget in seconds.
+         */
+        void RunFinalizers(double budget);
+
       public:
         virtual ~LoadingState() = default;
 
       public:
+        /**
+         * @brief Submits an independent loading job executed on the App's core::JobSystem.
+         *
+         * Can be called from Enter(), Task() or from another job. The optional finalization is then executed
+         * on the main thread, by slices within the budget defined with core::App::SetLoadingBudget(),
+         * this is where GL dependent work (e.g. texture upload) must be done.
+         *
+         * @param job The job to execute on a worker thread (e.g. file reading, image decoding).
+         * @param finalize Optional function executed on the main thread once the job is done.
+         * @param weight The weight of the job in the progress returned by GetProgress().
+         */
+        void AddJob(std::function<void()> job, std::function<void()> finalize = nullptr, float weight = 1.0f);
+
+        /**
+         * @brief Gets the progress of the jobs submitted with AddJob(), weighted by their weights.
+         *        A job is counted as done once its finalization has been executed.
+         * @return The progress, from 0 to 1 (1 if no job has been submitted).
+         */
+        float GetProgress() const;
+
         /**
          * @brief The main task to be executed in a separate thread during the state's execution.
+         *        Additional jobs submitted with AddJob() are executed in parallel on the core::JobSystem.
          */
-        virtual void Task() = 0;
+        virtual void Task()
+        { }
 
         /**
          * @brief Optional task executed after the main Task on the main thread.
+         *        It is called once Task() and all the jobs (with their finalizations) are done.
          */
         virtual void PostTask()
         { }
     };
 
+    /**
+     * @brief Defines how the outgoing state is handled during a core::App::Transition().
+     */
+    enum class TransitionMode
+    {
+        Live,           ///< Both states are updated and drawn every frame of the transition.
+        Snapshot        ///< The outgoing state is drawn once into a frozen snapshot, only the incoming state is updated and drawn.
+    };
+
     /**
      * @brief The App class represents the main application framework.
      */
@@ -106,6 +208,13 @@ namespace rf { namespace core {
         AssetManager assetManager;                  ///< Basic generic asset manager.
         MusicManager musicManager;                  ///< State independent music and playlist manager.
         std::unique_ptr<SaveManager> saveManager;   ///< Basic generic save manager (optionnal).
+        Profiler profiler;                          ///< Frame phases and user scopes profiler (disabled by default).
+        JobSystem jobSystem;                        ///< Work stealing job system shared by all subsystems (one worker per core).
+        RenderTargetPool renderTargets;             ///< Pool of render targets shared by the renderers and user passes (post-processing...).
+        PostProcessChain postProcess;               ///< Post-processing passes applied when the main renderer is drawn to the screen.
+        FrameLimiter frameLimiter;                  ///< Frame pacing of Run() and loading screens, with frame time histogram and missed deadlines.
+        FrameArena frameArena;                      ///< Temporary memory of the states, valid for the current and the next frame.
+        FrameCapture frameCapture;                  ///< Asynchronous recording of the main renderer (screenshots, videos, visual tests).
 
       private:
         std::unordered_map<std::string, std::unique_ptr<State>> states;                 ///< Map of all states.
@@ -115,7 +224,7 @@ namespace rf { namespace core {
       private:
         Cursor cursor;                                      ///< Custom mouse cursor.
         Renderer renderer;                                  ///< Renderer instance for the application.
-        Renderer rendererTransition;                        ///< Renderer used for rendering the next state during transition.
+        Renderer rendererTransition;                        ///< Renderer used for rendering the next state during transition, only loaded while used.
         raylib::Shader *shaderMain = nullptr;               ///< Main shader applied to all rendering, including transitions.
         raylib::Shader *shaderTransition = nullptr;         ///< Transition shader for custom transition effects.
 
@@ -124,15 +233,60 @@ namespace rf { namespace core {
         int locTransitionNextTexture = 0;                   ///< Uniform location for the texture of the next state during custom transition.
         float valTransitionProgress = 0.0f;                 ///< Internal value of the transition progress (float from 0 to 1).
         float valTransitionInvDuration = 1.0f;              ///< Inverse of the desired duration in seconds for a custom transition (1/duration).
+        TransitionMode transitionMode = TransitionMode::Live;   ///< Mode of the current transition.
+        bool transitionSnapshotTaken = false;               ///< Flag indicating whether the snapshot of the outgoing state has been captured.
+
+      private:
+        bool fixedStepEnabled = false;                      ///< Flag indicating whether the fixed timestep mode is enabled.
+        int fixedStepMaxSteps = 5;                          ///< Maximum number of fixed steps performed in a single frame.
+        float fixedStepDelta = 1.0f / 60.0f;                ///< Duration of a fixed step in seconds (1/tickRate).
+        float fixedStepAccumulator = 0.0f;                  ///< Accumulated frame time not yet consumed by fixed steps.
+        float fixedStepAlpha = 1.0f;                        ///< Interpolation factor between the two last fixed steps.
+
+      private:
+        double loadingBudget = 0.004;                       ///< Time budget per frame in seconds for the loading jobs finalizations.
+
+      private:
+        bool dynResEnabled = false;                         ///< Flag indicating whether the dynamic resolution is enabled.
+        float dynResMinScale = 0.5f;                        ///< Lowest render scale of the dynamic resolution.
+        float dynResMaxScale = 1.0f;                        ///< Highest render scale of the dynamic resolution.
+        double dynResBudget = 0.0;                          ///< Frame time budget in seconds, zero to use the target FPS.
+        double dynResCost = 0.0;                            ///< Smoothed frame cost in seconds.
+        uint32_t dynResFrames = 0;                          ///< Frames elapsed since the last evaluation of the render scale.
+        double frameBudget = 1.0 / 60.0;                    ///< Duration of a frame at the target FPS given to Run().
+        double frameStart = 0.0;                            ///< Time at which the current frame started.
+        double frameDrawEnd = 0.0;                          ///< Time at which the current frame was submitted, before EndDrawing().
+
+      private:
+        bool pipelined = false;                             ///< Flag indicating whether Update() runs concurrently with Draw().
+        State *pipelineState = nullptr;                     ///< State whose first snapshot has been produced, pipeline restarts if it changes.
+        JobCounter pipelineCounter;                         ///< Counter of the simulation job of the pipelined mode.
+
+      private:
+        CommandQueue mainQueue;                             ///< Commands posted by any thread to be executed on the main thread.
+        double mainQueueBudget = 0.002;                     ///< Time budget per frame in seconds for the main thread commands.
 
       private:
         bool running = false;           ///< Flag indicating whether the application is running.
+        bool headless = false;          ///< Flag indicating whether the App runs without window (failed hidden window creation).
         int retCode = 0;                ///< Return code of the application.
+        bool memoryOverlay = false;     ///< Flag indicating whether the memory statistics are drawn over the frame.
 
       private:
         void Init(const std::string& title, const Vector2& winSize, const Vector2& targetSize, bool keepAspectRatio, uint32_t flags, bool initAudio);
+        int ConsumeFixedSteps(float dt);
         void UpdateAndDraw();
+        void UpdateAndDrawPipelined();
         void UpdateAndDrawTransition();
+        void CaptureTransitionSnapshot();
+        void UpdateDynamicResolution();
+        void BakeMainEffects(Renderer& target);
+        void DrawMainRenderer();
+        void DrawScreenOverlays();
+        void DrawMemoryOverlay() const;
+        void BeginFrame();
+        void EndFrame(bool drawn);
+        void RunFrame();
 
       private:
 #     ifdef PLATFORM_WEB
@@ -142,9 +296,7 @@ namespace rf { namespace core {
         static void UpdateAndDrawLoopCallback(void* arg)
         {
             auto app = static_cast<core::App*>(arg);
-            if (app->nextState == nullptr) app->UpdateAndDraw();
-            else app->UpdateAndDrawTransition();
-            app->musicManager.Update();
+            app->RunFrame();
         }
 #     endif
 
@@ -157,6 +309,9 @@ namespace rf { namespace core {
          * @param keepAspectRatio Whether to keep the aspect ratio when resizing the window.
          * @param flags Additional flags for window creation.
          * @param initAudio Whether to initialize the audio subsystem.
+         *
+         * If FLAG_WINDOW_HIDDEN is set and the window cannot be created (e.g. CI machine without display or GPU),
+         * the App is created in headless mode instead of throwing, which is only usable with Benchmark() in NoDraw mode.
          */
         App(const std::string& title, const Vector2& winSize, const Vector2& targetSize, bool keepAspectRatio = true, uint32_t flags = 0, bool initAudio = true);
 
@@ -170,6 +325,11 @@ namespace rf { namespace core {
          */
         App(const std::string& title, int width, int height, uint32_t flags = 0, bool initAudio = true);
 
+        /**
+         * @brief Destructor, waits for the pending jobs before releasing the App's resources.
+         */
+        ~App();
+
         /**
          * @brief Initializes the SaveManager with the specified parameters.
          * @tparam _Ts The type of the object to be saved.
@@ -185,6 +345,7 @@ namespace rf { namespace core {
 
         /**
          * @brief Sets the main shader for rendering.
+         *        Not applied while 'postProcess' has enabled passes, it can be added to the chain as a pass instead.
          * @param shader Pointer to the main shader.
          */
         void SetMainShader(raylib::Shader* shader)
@@ -192,6 +353,148 @@ namespace rf { namespace core {
             shaderMain = shader;
         }
 
+        /**
+         * @brief Enables or disables the fixed timestep mode.
+         *
+         * When enabled, State::FixedUpdate() is called at a constant rate independent of the display rate,
+         * in addition to State::Update() which is still called once per frame with the variable delta time.
+         * The remaining time is exposed as an interpolation factor passed to State::Draw(target, alpha).
+         *
+         * @param enabled True to enable the fixed timestep mode, false to disable it.
+         * @param tickRate Number of fixed steps per second (default is 60).
+         * @param maxSteps Maximum number of catch-up steps performed in a single frame (default is 5).
+         *                 Any remaining time beyond this limit is dropped to avoid a spiral of death.
+         */
+        void SetFixedTimestep(bool enabled, uint32_t tickRate = 60, int maxSteps = 5);
+
+        /**
+         * @brief Checks if the fixed timestep mode is enabled.
+         * @return True if enabled, false otherwise.
+         */
+        bool IsFixedTimestep() const
+        {
+            return fixedStepEnabled;
+        }
+
+        /**
+         * @brief Gets the duration of a fixed step in seconds.
+         * @return The fixed step delta time (1/tickRate).
+         */
+        float GetFixedStep() const
+        {
+            return fixedStepDelta;
+        }
+
+        /**
+         * @brief Gets the interpolation factor between the two last fixed steps for the current frame.
+         * @return The interpolation factor (0 to 1), always 1 when the fixed timestep mode is disabled.
+         */
+        float GetFixedStepAlpha() const
+        {
+            return fixedStepAlpha;
+        }
+
+        /**
+         * @brief Enables or disables the dynamic resolution.
+         *
+         * When enabled, the render scale of the main renderer (see Renderer::SetRenderScale()) is lowered when the
+         * frames exceed the time budget and raised again when there is enough headroom, by steps of 5% between
+         * the given bounds. The cost of a frame is its CPU time until the submission, or its full duration when the
+         * deadline is missed, which also accounts for the GPU bound frames blocking on the swap.
+         * The resolution is only changed between two frames and outside transitions, and the targets are borrowed
+         * from the App's RenderTargetPool. GetResolution() and GetMousePosition() remain in logical coordinates.
+         *
+         * @param enabled True to enable the dynamic resolution, false to disable it and restore the full resolution.
+         * @param budgetMs The frame time budget in milliseconds, zero to use the target FPS given to Run() (default is 0).
+         * @param minScale The lowest render scale (default is 0.5).
+         * @param maxScale The highest render scale (default is 1).
+         */
+        void SetDynamicResolution(bool enabled, float budgetMs = 0.0f, float minScale = 0.5f, float maxScale = 1.0f);
+
+        /**
+         * @brief Checks if the dynamic resolution is enabled.
+         * @return True if enabled, false otherwise.
+         */
+        bool IsDynamicResolution() const
+        {
+            return dynResEnabled;
+        }
+
+        /**
+         * @brief Gets the current render scale of the main renderer.
+         * @return The render scale, 1 at full resolution.
+         */
+        float GetResolutionScale() const
+        {
+            return renderer.GetRenderScale();
+        }
+
+        /**
+         * @brief Enables or disables the pipelined mode.
+         *
+         * In pipelined mode, the FixedUpdate()/Update() of frame N+1 run on a worker of the JobSystem while the
+         * main thread draws frame N from the data published by State::Sync() (see core::RenderBuffer), which
+         * roughly halves the frame time of scenes whose update and draw are both CPU heavy. The input is polled
+         * before the update is started and the frame is presented once it is done, so the results are displayed
+         * one frame later than in serial mode. SetState(), Transition() and Loading() called from Update() are
+         * deferred to the main thread. Transitions and loading screens are always executed serially.
+         * Update() must not add nor remove assets. While it runs, an evicted asset looked up from Update() or Draw()
+         * is not reloaded in place: the reload is posted to the main thread queue and executed at the end of the
+         * frame, once the update is done, the lookup returning nullptr meanwhile.
+         *
+         * @param enabled True to enable the pipelined mode, false to run Update() and Draw() serially.
+         */
+        void SetPipelined(bool enabled)
+        {
+            pipelined = enabled;
+            pipelineState = nullptr;
+        }
+
+        /**
+         * @brief Checks if the pipelined mode is enabled.
+         * @return True if enabled, false otherwise.
+         */
+        bool IsPipelined() const
+        {
+            return pipelined;
+        }
+
+        /**
+         * @brief Sets the time budget per frame for the main thread finalizations of the loading jobs.
+         * @param milliseconds The budget in milliseconds (default is 4ms).
+         */
+        void SetLoadingBudget(float milliseconds)
+        {
+            loadingBudget = milliseconds * 0.001;
+        }
+
+        /**
+         * @brief Posts a command to be executed on the main thread, where the GL context is current.
+         *
+         * Can be called from any thread (loading task, jobs, network...). The pending commands are executed
+         * between two frames within the budget defined with SetMainThreadBudget(), including during loading screens.
+         * If called from the main thread, the command is executed immediately.
+         *
+         * @tparam _Fn Callable without parameter.
+         * @param func The command to execute (e.g. a texture upload).
+         * @return A std::future holding the result of the command.
+         */
+        template <typename _Fn>
+        auto PostToMainThread(_Fn&& func)
+        {
+            return mainQueue.Post(std::forward<_Fn>(func));
+        }
+
+        /**
+         * @brief Sets the time budget per frame for the commands posted with PostToMainThread().
+         *        At least one pending command is executed per frame whatever the budget.
+         * @param milliseconds The budget in milliseconds (default is 2ms).
+         */
+        void SetMainThreadBudget(float milliseconds)
+        {
+            mainQueueBudget = milliseconds * 0.001;
+        }
+
         /**
          * @brief Initiates a loading screen and executes a loading task.
          * @tparam _Tls The type of LoadingState to be used.
@@ -221,17 +524,77 @@ namespace rf { namespace core {
          * @param stateName The name of the state to transition to.
          * @param duration The duration of the transition in seconds (default is 1.0f).
          * @param shader The shader to use for the transition (default is nullptr).
+         * @param mode With TransitionMode::Snapshot, the current state is no longer updated and is blended as a frozen image,
+         *             which keeps the cost of a transition frame close to a normal frame (default is TransitionMode::Live).
          */
-        void Transition(const std::string& stateName, float duration = 1.0f, raylib::Shader* shader = nullptr);
+        void Transition(const std::string& stateName, float duration = 1.0f, raylib::Shader* shader = nullptr, TransitionMode mode = TransitionMode::Live);
 
         /**
          * @brief Runs the application with the specified initial state.
          * @param firstState The name of the first state to run.
-         * @param targetFPS The target frames per second for the application.
+         * @param targetFPS The target frames per second for the application, paced by 'frameLimiter' (zero for unlimited).
          * @return The return code of the application.
          */
         int Run(const std::string& firstState, uint32_t targetFPS = 60);
 
+        /**
+         * @brief Runs the given state for a fixed number of frames with a forced delta time and reports its timings.
+         *
+         * The state is entered, updated (and drawn depending on the mode) 'frames' times, then exited.
+         * The profiler is enabled during the run and its per-phase statistics are included in the report.
+         * If the App is headless, the mode falls back to BenchmarkMode::NoDraw.
+         * The drawn frames are recorded by 'frameCapture' if a recording is started, e.g. for visual tests.
+         * Each frame also runs the end of frame work of Run() (main thread queue, render targets and assets
+         * collection), without frame pacing and with the dynamic resolution suspended.
+         *
+         * @param stateName The name of the state to benchmark.
+         * @param frames The number of frames to execute.
+         * @param dt The delta time given to the state for each frame (default is 1/60).
+         * @param mode What is executed for each frame (default is BenchmarkMode::Offscreen).
+         * @return The report of the run, with 'frames' at zero if the state was not found.
+         */
+        BenchmarkReport Benchmark(const std::string& stateName, uint32_t frames, float dt = 1.0f / 60.0f, BenchmarkMode mode = BenchmarkMode::Offscreen);
+
+        /**
+         * @brief Gets the memory statistics of the instrumented subsystems.
+         *
+         * The tracking is compiled in with the RAYFLEX_MEMORY_TRACKING option, otherwise all the statistics are zero.
+         * The per frame allocation counts are those of the last completed frame, see MemoryReport::Save() to dump them as JSON.
+         *
+         * @return The report of all the memory tags.
+         */
+        MemoryReport GetMemoryReport() const
+        {
+            return MemoryTracker::GetReport();
+        }
+
+        /**
+         * @brief Enables or disables the drawing of the memory statistics over the frame, after Renderer::Draw().
+         * @param enabled True to draw the overlay, false otherwise.
+         */
+        void SetMemoryOverlay(bool enabled)
+        {
+            memoryOverlay = enabled;
+        }
+
+        /**
+         * @brief Checks if the memory overlay is drawn.
+         * @return True if drawn, false otherwise.
+         */
+        bool IsMemoryOverlay() const
+        {
+            return memoryOverlay;
+        }
+
+        /**
+         * @brief Checks if the App runs without window.
+         * @return True if the App is headless, false otherwise.
+         */
+        bool IsHeadless() const
+        {
+            return headless;
+        }
+
         /**
          * @brief Finishes the application with the specified return code.
          * @param ret The return code to set (default is 0).
@@ -273,7 +636,7 @@ namespace rf { namespace core {
         float GetAspectRatio() const;
 
         /**
-         * @brief Gets the current resolution of the render targets.
+         * @brief Gets the current (logical) resolution of the render targets, independent of the dynamic resolution.
          * @return The resolution as a raylib::Vector2.
          */
         raylib::Vector2 GetResolution() const;
@@ -324,6 +687,13 @@ namespace rf { namespace core {
     template<typename _Tls>
     void App::Loading()
     {
+        // Called from a pipelined Update(), the loading screen is started by the main thread
+        if (!mainQueue.IsOwnerThread())
+        {
+            mainQueue.Post([this]() { Loading<_Tls>(); });
+            return;
+        }
+
     #ifdef PLATFORM_WEB
         // It doesn't matter what options when linking or where we call this method (before or during the main loop)
         // the thread seems to never launch with emscripten (firefox/chromium). To see again in the future...
@@ -333,6 +703,9 @@ namespace rf { namespace core {
         loadingState->Enter();
 
         loadingState->Task();
+        jobSystem.Wait(loadingState->jobsCounter);
+        mainQueue.Execute(std::numeric_limits<double>::infinity());
+        loadingState->RunFinalizers(std::numeric_limits<double>::infinity());
         loadingState->PostTask();
 
         loadingState->Exit();
@@ -345,19 +718,45 @@ namespace rf { namespace core {
         bool doPostTask = true;
         float alphaTrans = EPSILON;
 
-        std::atomic<bool> onLoading = true;
-        std::thread taskThread([&loadingState, &onLoading]() {
-            loadingState->Task(); onLoading = false;
+        rendererTransition.SetRenderScale(renderer.GetRenderScale());
+        rendererTransition.Load(renderer.GetSize(), renderer.IsRatioKept());
+
+        std::atomic<bool> onTask = true;
+        std::thread taskThread([this, &loadingState, &onTask]() {
+            profiler.SetThreadName("LoadingState::Task");
+            {
+                RF_PROFILE_SCOPE(profiler, "LoadingState::Task");
+                loadingState->Task();
+            }
+            onTask = false;
         });
 
         while (alphaTrans > 0.0f)
         {
+            profiler.EndFrame(); // Consumes the events of the previous frame
+            RF_PROFILE_SCOPE(profiler, "Frame");
+            frameArena.NewFrame();
+            MemoryTracker::NewFrame();
+
             float dt = GetFrameTime();
 
-            musicManager.Update();
+            {
+                RF_PROFILE_SCOPE(profiler, "LoadingState::Finalize");
+                loadingState->RunFinalizers(loadingBudget);
+            }
+
+            {
+                RF_PROFILE_SCOPE(profiler, "CommandQueue::Execute");
+                mainQueue.Execute(mainQueueBudget);
+            }
+
+            // Jobs can only be added by the task or by other jobs, so once the task is
+            // finished and the counter is at zero, nothing more can be submitted
+            const bool onLoading = onTask || !loadingState->IsJobsDone();
 
             if (!onLoading && doPostTask)
             {
+                RF_PROFILE_SCOPE(profiler, "LoadingState::PostTask");
                 loadingState->PostTask();
                 doPostTask = false;
             }
@@ -365,17 +764,32 @@ namespace rf { namespace core {
             if (onLoading && alphaTrans < 1.0f) alphaTrans = std::min(alphaTrans + 4.0f * dt, 1.0f);
             else if (!onLoading) alphaTrans = std::max(alphaTrans - 4.0f * dt, 0.0f);
 
-            loadingState->Update(dt);
+            {
+                RF_PROFILE_SCOPE(profiler, "State::Update");
+                loadingState->Update(dt);
+                loadingState->Sync();
+            }
 
-            rendererTransition.BeginMode();
-                loadingState->Draw(rendererTransition);
-            rendererTransition.EndMode();
+            {
+                RF_PROFILE_SCOPE(profiler, "State::Draw");
+                rendererTransition.BeginMode();
+                    loadingState->Draw(rendererTransition);
+                rendererTransition.EndMode();
+            }
 
             window.BeginDrawing().ClearBackground();
-                renderer.Draw(); // We redraw the previous state behind the loading screen
+            {
+                RF_PROFILE_SCOPE(profiler, "Renderer::Draw");
+                DrawMainRenderer(); // We redraw the previous state behind the loading screen
                 rendererTransition.Draw({ 255, 255, 255, static_cast<uint8_t>(255 * alphaTrans) });
-                if (cursor.IsActive()) cursor.Draw(::GetMousePosition());
-            window.EndDrawing();
+                DrawScreenOverlays();
+            }
+            {
+                RF_PROFILE_SCOPE(profiler, "EndDrawing");
+                window.EndDrawing();
+            }
+
+            frameLimiter.Wait();
         }
 
         if (taskThread.joinable())
@@ -383,6 +797,10 @@ namespace rf { namespace core {
             taskThread.join();
         }
 
+        jobSystem.Wait(loadingState->jobsCounter);
+
+        if (!OnTransition()) rendererTransition.Unload();
+
         loadingState->Exit();
         delete loadingState;
     #endif
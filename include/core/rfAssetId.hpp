@@ -0,0 +1,275 @@
+#ifndef RAYFLEX_CORE_ASSET_ID_HPP
+#define RAYFLEX_CORE_ASSET_ID_HPP
+
+#include <string_view>
+#include <functional>
+#include <utility>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The AssetId class is a 64-bit FNV-1a hash of an asset name, computable at compile time.
+     *
+     * It is implicitly constructible from string literals, C strings, std::string and std::string_view,
+     * so that lookups never allocate. Declare ids 'constexpr' (or use the _id literal) to hash at compile time.
+     *
+     * A view of the source string is kept to allow core::AssetManager to record the name on insertion,
+     * an id built from a temporary string must therefore not be stored to insert an asset later.
+     */
+    class AssetId
+    {
+      private:
+        uint64_t value = 0;             ///< Hash of the name, never zero for a valid id.
+        std::string_view name;          ///< View of the source name, only valid during the call that built the id.
+
+      public:
+        /**
+         * @brief Computes the 64-bit FNV-1a hash of a string.
+         * @param str The string to hash.
+         * @return The hash, zero being remapped to one as zero marks empty slots.
+         */
+        static constexpr uint64_t Hash(std::string_view str)
+        {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for (char c : str)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 0x100000001b3ull;
+            }
+            return hash != 0 ? hash : 1;
+        }
+
+      public:
+        constexpr AssetId() = default;
+        constexpr AssetId(std::string_view str) : value(Hash(str)), name(str) { }
+        constexpr AssetId(const char* str) : AssetId(std::string_view(str)) { }
+        AssetId(const std::string& str) : AssetId(std::string_view(str)) { }
+
+        /**
+         * @brief Gets the hash value of the id.
+         * @return The hash value.
+         */
+        constexpr uint64_t GetValue() const
+        {
+            return value;
+        }
+
+        /**
+         * @brief Gets the view of the source name, see the class description for its lifetime.
+         * @return The name the id was built from, empty if unknown.
+         */
+        constexpr std::string_view GetSourceName() const
+        {
+            return name;
+        }
+
+        constexpr bool operator==(const AssetId& other) const { return value == other.value; }
+        constexpr bool operator!=(const AssetId& other) const { return value != other.value; }
+    };
+
+    inline namespace literals {
+
+        /**
+         * @brief Builds an AssetId at compile time: "player"_id.
+         */
+        constexpr AssetId operator""_id(const char* str, std::size_t len)
+        {
+            return AssetId(std::string_view(str, len));
+        }
+
+    }
+
+    /**
+     * @brief The AssetIdMap class is a flat open addressing hash table (linear probing) keyed by AssetId hash values.
+     *
+     * Values are stored inline in a single array, so pointers to values are invalidated by insertions (rehash) and erasures.
+     * @tparam V The type of the stored values (default constructible and movable).
+     */
+    template <typename V>
+    class AssetIdMap
+    {
+      public:
+        using Slot = std::pair<uint64_t, V>;    ///< Slot of the table, key zero means empty.
+
+        /**
+         * @brief Forward iterator over the occupied slots.
+         */
+        template <typename S>
+        class Iterator
+        {
+          private:
+            S *slot, *end;
+
+            void Skip() { while (slot != end && slot->first == 0) slot++; }
+
+          public:
+            Iterator(S* slot, S* end) : slot(slot), end(end) { Skip(); }
+            S& operator*() const { return *slot; }
+            S* operator->() const { return slot; }
+            Iterator& operator++() { slot++; Skip(); return *this; }
+            bool operator==(const Iterator& other) const { return slot == other.slot; }
+            bool operator!=(const Iterator& other) const { return slot != other.slot; }
+        };
+
+      private:
+        std::vector<Slot> slots;        ///< Slots of the table, the size is always a power of two (or zero).
+        std::size_t count = 0;          ///< Number of occupied slots.
+
+      private:
+        std::size_t Mask() const
+        {
+            return slots.size() - 1;
+        }
+
+        /**
+         * @brief Finds the slot of the key, or the empty slot where it would be inserted.
+         */
+        std::size_t Probe(uint64_t key) const
+        {
+            std::size_t i = key & Mask();
+            while (slots[i].first != 0 && slots[i].first != key) i = (i + 1) & Mask();
+            return i;
+        }
+
+        void Rehash(std::size_t capacity)
+        {
+            std::vector<Slot> old(capacity);
+            old.swap(slots);
+
+            for (auto& slot : old)
+            {
+                if (slot.first != 0) slots[Probe(slot.first)] = std::move(slot);
+            }
+        }
+
+        void Grow()
+        {
+            // Keeps the load factor under 70%
+            if ((count + 1) * 10 > slots.size() * 7)
+            {
+                Rehash(slots.empty() ? 16 : slots.size() * 2);
+            }
+        }
+
+      public:
+        /**
+         * @brief Finds the value associated with a key.
+         * @param key The key to find.
+         * @return A pointer to the value, or nullptr if not found.
+         */
+        V* Find(uint64_t key)
+        {
+            if (count == 0) return nullptr;
+            Slot &slot = slots[Probe(key)];
+            return slot.first != 0 ? &slot.second : nullptr;
+        }
+
+        const V* Find(uint64_t key) const
+        {
+            if (count == 0) return nullptr;
+            const Slot &slot = slots[Probe(key)];
+            return slot.first != 0 ? &slot.second : nullptr;
+        }
+
+        /**
+         * @brief Finds the slot of a key.
+         * @param key The key to find.
+         * @return An iterator to the slot, or end() if not found.
+         */
+        Iterator<const Slot> FindIterator(uint64_t key) const
+        {
+            if (count == 0) return end();
+            const std::size_t i = Probe(key);
+            return slots[i].first != 0 ? Iterator<const Slot>(slots.data() + i, slots.data() + slots.size()) : end();
+        }
+
+        /**
+         * @brief Inserts a value if the key is not present.
+         * @return A pair with a pointer to the value associated with the key and whether the insertion took place.
+         */
+        std::pair<V*, bool> Emplace(uint64_t key, V&& value)
+        {
+            if (V* existing = Find(key)) return { existing, false };
+            Grow();
+            Slot &slot = slots[Probe(key)];
+            slot.first = key, slot.second = std::move(value);
+            count++;
+            return { &slot.second, true };
+        }
+
+        /**
+         * @brief Inserts a value or replaces the existing one.
+         * @return A pair with a pointer to the value and whether an insertion (rather than an assignment) took place.
+         */
+        std::pair<V*, bool> InsertOrAssign(uint64_t key, V&& value)
+        {
+            if (V* existing = Find(key))
+            {
+                *existing = std::move(value);
+                return { existing, false };
+            }
+            return Emplace(key, std::move(value));
+        }
+
+        /**
+         * @brief Removes the value associated with a key, using backward shift deletion (no tombstones).
+         * @return True if a value was removed, false otherwise.
+         */
+        bool Erase(uint64_t key)
+        {
+            if (count == 0) return false;
+
+            std::size_t i = Probe(key);
+            if (slots[i].first == 0) return false;
+
+            for (std::size_t j = (i + 1) & Mask(); slots[j].first != 0; j = (j + 1) & Mask())
+            {
+                // Moves back the entries whose ideal position is not between the hole and themselves
+                const std::size_t ideal = slots[j].first & Mask();
+                if (((j - ideal) & Mask()) >= ((j - i) & Mask()))
+                {
+                    slots[i] = std::move(slots[j]);
+                    i = j;
+                }
+            }
+
+            slots[i].first = 0;
+            slots[i].second = V();
+            count--;
+
+            return true;
+        }
+
+        /**
+         * @brief Reserves space for the given number of values.
+         */
+        void Reserve(std::size_t size)
+        {
+            std::size_t capacity = 16;
+            while (size * 10 > capacity * 7) capacity *= 2;
+            if (capacity > slots.size()) Rehash(capacity);
+        }
+
+        std::size_t Size() const { return count; }
+
+        auto begin() { return Iterator<Slot>(slots.data(), slots.data() + slots.size()); }
+        auto end() { return Iterator<Slot>(slots.data() + slots.size(), slots.data() + slots.size()); }
+        auto begin() const { return Iterator<const Slot>(slots.data(), slots.data() + slots.size()); }
+        auto end() const { return Iterator<const Slot>(slots.data() + slots.size(), slots.data() + slots.size()); }
+    };
+
+}}
+
+template <>
+struct std::hash<rf::core::AssetId>
+{
+    std::size_t operator()(const rf::core::AssetId& id) const noexcept
+    {
+        return static_cast<std::size_t>(id.GetValue());
+    }
+};
+
+#endif //RAYFLEX_CORE_ASSET_ID_HPP
@@ -1,290 +1,1103 @@
 #ifndef RAYFLEX_CORE_ASSET_MANAGER_HPP
 #define RAYFLEX_CORE_ASSET_MANAGER_HPP
 
+#include "./rfCommandQueue.hpp"
+#include "./rfJobSystem.hpp"
+#include "./rfAssetTraits.hpp"
+#include "./rfAssetPool.hpp"
+#include "./rfAssetId.hpp"
+#include "./rfMemoryTracker.hpp"
+
 #include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
+#include <atomic>
 #include <memory>
+#include <array>
 #include <string>
+#include <mutex>
 
 namespace rf { namespace core {
 
     /**
-     * @brief The Asset class represents a movable container for any type of data.
+     * @brief The AssetRef class is an untyped reference to an asset of core::AssetManager, returned by its string API.
+     *        It does not own the asset and follows the lifetime of a pointer to it.
      */
-    class Asset
+    class AssetRef
     {
       private:
-        std::unique_ptr<void, void(*)(void*)> data{nullptr, [](void*){}};
-        std::reference_wrapper<const std::type_info> type; ///< Type information of the stored data.
+        void *data = nullptr;                                   ///< Address of the asset, null for an empty reference.
+        const std::type_info *type = &typeid(void);             ///< Type information of the asset.
 
       public:
+        AssetRef() = default;
+        AssetRef(void* data, const std::type_info& type) : data(data), type(&type) { }
+
         /**
-         * @brief Default constructor for an empty Asset.
+         * @brief Gets a pointer to the referenced asset.
+         * @tparam T The type of the asset.
+         * @return A pointer to the asset.
+         * @throws std::bad_cast if the reference is empty or the asset has a different type.
          */
-        Asset() : type(typeid(void)) {}
+        template <typename T>
+        T* Get() const
+        {
+            if (*type != typeid(T)) throw std::bad_cast();
+            return static_cast<T*>(data);
+        }
 
         /**
-         * @brief Constructor that takes a value of any type and moves it into the Asset.
-         * @tparam T The type of the value to be stored.
-         * @param value The value to be stored.
+         * @brief Gets the type information of the referenced asset.
+         * @return The type information, typeid(void) for an empty reference.
          */
-        template <typename T>
-        Asset(T&& value) : data(new typename std::decay<T>::type(std::move(value)),
-            [](void* ptr) { delete static_cast<typename std::decay<T>::type*>(ptr); })
-        , type(typeid(T)) { }
+        const std::type_info& Type() const
+        {
+            return *type;
+        }
 
         /**
-         * @brief Move constructor for Asset.
-         * @param other The rvalue reference to another Asset.
+         * @brief Checks if the reference refers to an asset.
          */
-        Asset(Asset&& other) noexcept
-        : data(std::exchange(other.data, nullptr))
-        , type(std::exchange(other.type, std::ref(typeid(void))))
-        { }
+        explicit operator bool() const
+        {
+            return data != nullptr;
+        }
+    };
 
+    /**
+     * @brief The AssetFuture class is a handle to an asset loaded asynchronously with AssetManager::AddAsync().
+     * @tparam _Ta The type of the asset.
+     */
+    template <typename _Ta>
+    class AssetFuture
+    {
+      public:
         /**
-         * @brief Move assignment operator for Asset.
-         * @param other The rvalue reference to another Asset.
-         * @return A reference to the current Asset after the move.
+         * @brief Loading status of an asynchronous asset.
          */
-        Asset& operator=(Asset&& other) noexcept
+        enum class Status { Pending, Ready, Failed };
+
+        /**
+         * @brief Shared state between the handle and the loading jobs.
+         *        The pool and the handle are written before the status is set to Status::Ready.
+         */
+        struct State
         {
-            if (this != &other)
-            {
-                // Move the data and type from the other Asset
-                data = std::exchange(other.data, nullptr);
-                type = std::exchange(other.type, std::ref(typeid(void)));
-            }
-            return *this;
+            std::atomic<Status> status{Status::Pending};    ///< Current status of the loading.
+            AssetPool<_Ta> *pool = nullptr;                 ///< Pool storing the asset once ready.
+            Handle<_Ta> handle;                             ///< Handle of the asset once ready.
+        };
+
+      private:
+        std::shared_ptr<State> state;   ///< State shared with the loading jobs.
+
+      public:
+        AssetFuture() = default;
+        AssetFuture(std::shared_ptr<State> state) : state(std::move(state)) { }
+
+        /**
+         * @brief Gets the loading status of the asset.
+         * @return The status, Status::Failed for an empty handle.
+         */
+        Status GetStatus() const
+        {
+            return state ? state->status.load(std::memory_order_acquire) : Status::Failed;
         }
 
         /**
-         * @brief Static function to create an Asset with a given type and constructor arguments.
-         * @tparam T The type of the value to be stored.
-         * @tparam Args Variadic template for constructor arguments.
-         * @param args The constructor arguments.
-         * @return An Asset containing the created value.
+         * @brief Checks if the asset is loaded and available.
+         * @return True if ready, false otherwise.
          */
-        template <typename T, typename... Args>
-        static Asset Make(Args&&... args)
+        bool IsReady() const
         {
-            return Asset(T(args...));
+            return GetStatus() == Status::Ready;
         }
 
         /**
-         * @brief Gets a pointer to the stored data of type T.
-         * @tparam T The type of the data to retrieve.
-         * @return A pointer to the stored data.
-         * @throws std::bad_cast if the stored type does not match the requested type.
+         * @brief Gets the handle of the asset.
+         * @return The handle, invalid if the asset is not ready yet.
          */
-        template <typename T> T* Get()
+        Handle<_Ta> GetHandle() const
         {
-            if (type.get() != typeid(T)) throw std::bad_cast();
-            return static_cast<T*>(data.get());
+            return IsReady() ? state->handle : Handle<_Ta>();
         }
 
         /**
-         * @brief Gets a pointer to the stored data of type T.
-         * @tparam T The type of the data to retrieve.
-         * @return A pointer to the stored data.
-         * @throws std::bad_cast if the stored type does not match the requested type.
+         * @brief Gets a pointer to the asset. Must be called from the main thread.
+         * @return The asset, or nullptr if it is not ready yet or has been removed since.
          */
-        template <typename T> const T* Get() const
+        _Ta* Get() const
         {
-            if (type.get() != typeid(T)) throw std::bad_cast();
-            return static_cast<T*>(data.get());
+            return IsReady() ? state->pool->Get(state->handle) : nullptr;
         }
 
         /**
-         * @brief Gets the type information of the stored data.
-         * @return The type information.
+         * @brief Gets a pointer to the asset, or the given placeholder while it is not ready.
+         * @param placeholder The asset to use until the real one is available.
+         * @return The asset or the placeholder.
          */
-        const std::type_info& Type() const
+        _Ta* GetOr(_Ta* placeholder) const
         {
-            return type;
+            _Ta *value = Get();
+            return value ? value : placeholder;
         }
     };
 
     /**
-     * @brief The AssetManager class manages assets/resources of various types using a map.
+     * @brief The AssetManager class manages assets/resources of various types.
+     *
+     * The assets are stored by type in pools (see core::AssetPool) and referenced by generation-checked
+     * core::Handle, resolving a handle being an array access. Iterating over all the assets of a type with
+     * GetPool() only visits the assets of this type.
+     *
+     * On top of this, assets are named with an AssetId, implicitly built from string literals or std::string
+     * without allocation, declare ids 'constexpr' (or use the _id literal) to hash the names at compile time.
+     * The names are recorded on insertion and can be recovered with GetName() for debugging purposes.
+     *
+     * The memory used by the assets is accounted per category (see core::AssetTraits) and can be limited
+     * with SetMemoryBudget(). When a budget is exceeded, the least recently used assets added with Load()
+     * whose reference count is zero (see Acquire(), Release() and core::AssetGuard) are evicted by the next Collect(),
+     * called by core::App at the end of each frame, so that a lookup never invalidates a pointer obtained earlier
+     * in the frame. An evicted asset is reloaded transparently from its loader the next time it is accessed by name,
+     * in the same slot: its handles and its address remain the same. Other assets are never evicted.
+     *
+     * The manager is not thread-safe and must only be modified from the main thread, only AddAsync() can be
+     * called from any thread. A pipelined State::Update() may look assets up, an evicted asset is then not
+     * available (nullptr) until its reload, posted to the main thread, is done. The same applies to the lookups
+     * of the concurrent State::Draw(), the reloads only run once the update is finished.
+     *
+     * Assets never move in memory: a pointer obtained from Add(), Get() or Load() remains valid until this asset
+     * is removed, replaced by an asset of another type, or evicted. Insertions and removals of other assets do not
+     * affect it, and replacing an asset with one of the same type assigns it in place. Handles (see GetHandle())
+     * additionally detect the removal of the asset and are the fast path to access it.
      */
     class AssetManager
     {
       private:
-        std::unordered_map<std::string, Asset> map; ///< Map of assets with their associated names.
+        /**
+         * @brief Untyped handle associated with a name.
+         */
+        struct Entry
+        {
+            uint32_t type = 0;          ///< Index of the type of the asset, see AssetPoolBase::TypeIndex().
+            uint32_t index = 0;         ///< Index of the slot in the pool.
+            uint32_t generation = 0;    ///< Generation of the slot in the pool.
+            uint32_t refs = 0;          ///< Number of references acquired, the asset cannot be evicted if non-zero.
+            uint64_t lastUse = 0;       ///< Tick of the last access by name, for the LRU eviction.
+            std::size_t size = 0;       ///< Memory used by the asset in bytes.
+            AssetCategory category = AssetCategory::Other; ///< Memory category of the asset.
+            bool evicted = false;       ///< Flag indicating whether the asset has been evicted and must be reloaded.
+        };
+
+      private:
+        std::vector<std::unique_ptr<AssetPoolBase>> pools;      ///< Pools of assets indexed by type index.
+        AssetIdMap<Entry> map;                                  ///< Handles of the named assets indexed by the hash of their names.
+        std::unordered_map<uint64_t, std::string> names;        ///< Names of the assets, for debugging purposes.
+
+      private:
+        static constexpr std::size_t NumCategories = static_cast<std::size_t>(AssetCategory::Count);
+
+        std::unordered_map<uint64_t, std::function<void()>> sources; ///< Reload functions of the evictable assets.
+        std::array<std::size_t, NumCategories> usage{};         ///< Memory used per category in bytes.
+        std::array<std::size_t, NumCategories> budgets{};       ///< Memory budget per category in bytes (0 for unlimited).
+        std::size_t totalBudget = 0;                            ///< Memory budget for all categories in bytes (0 for unlimited).
+        uint64_t tick = 0;                                      ///< Counter incremented on each access by name.
+
+      private:
+        JobSystem *jobSystem = nullptr;                         ///< Job system decoding the asynchronous assets (synchronous if null).
+        CommandQueue *mainQueue = nullptr;                      ///< Queue finalizing the asynchronous assets on the main thread (immediate if null).
+        bool reloadsDeferred = false;                           ///< Flag indicating whether the main thread also posts its reloads (see SetReloadsDeferred()).
+        std::unordered_map<uint64_t, std::shared_ptr<void>> pending; ///< Asynchronous assets still loading.
+        mutable std::mutex pendingMutex;                        ///< Protects the pending assets.
+
+      private:
+        /**
+         * @brief Records the name of an inserted asset.
+         * @param id The id of the asset, with a valid source name.
+         */
+        void RecordName(AssetId id)
+        {
+            auto it = names.find(id.GetValue());
+            if (it == names.end())
+            {
+                names.emplace(id.GetValue(), std::string(id.GetSourceName()));
+            }
+            else if (!id.GetSourceName().empty() && it->second != id.GetSourceName())
+            {
+                throw std::invalid_argument("AssetManager: hash collision between asset names '"
+                    + it->second + "' and '" + std::string(id.GetSourceName()) + "'");
+            }
+        }
+
+        /**
+         * @brief Gets the pool of a type, creating it if needed.
+         */
+        template <typename _Ta>
+        AssetPool<_Ta>& Pool()
+        {
+            const uint32_t type = AssetPoolBase::TypeIndex<_Ta>();
+            if (type >= pools.size()) pools.resize(type + 1);
+            if (!pools[type]) pools[type] = std::make_unique<AssetPool<_Ta>>();
+            return static_cast<AssetPool<_Ta>&>(*pools[type]);
+        }
+
+        /**
+         * @brief Inserts or replaces a named asset and returns its handle.
+         *        An invalid handle is returned if the name is taken and replace is false.
+         */
+        template <typename _Ta>
+        Handle<_Ta> Store(AssetId id, _Ta&& value, bool replace)
+        {
+            if (id.GetValue() == 0) throw std::invalid_argument("AssetManager: invalid asset id");
+
+            RecordName(id);
+
+            const uint32_t type = AssetPoolBase::TypeIndex<_Ta>();
+            AssetPool<_Ta> &pool = Pool<_Ta>();
+
+            const AssetCategory category = AssetTraits<_Ta>::category;
+            const std::size_t size = AssetTraits<_Ta>::GetSize(value);
+
+            Entry *entry = map.Find(id.GetValue());
+            Handle<_Ta> handle;
+
+            if (entry)
+            {
+                if (!replace) return {};
+
+                if (!entry->evicted)
+                {
+                    usage[static_cast<std::size_t>(entry->category)] -= entry->size;
+                    MemoryTracker::Free(MemoryTag::Assets, entry->size);
+                }
+
+                // Replacing or reloading with the same type keeps the handles valid
+                handle = { entry->index, entry->generation };
+                if (entry->type == type && pool.Contains(handle))
+                {
+                    *pool.Get(handle) = std::move(value);
+                }
+                else if (entry->type != type || !pool.Restore(handle, std::move(value)))
+                {
+                    pools[entry->type]->Remove(entry->index, entry->generation);
+                    handle = pool.Insert(std::move(value));
+                }
+            }
+            else
+            {
+                handle = pool.Insert(std::move(value));
+                entry = map.Emplace(id.GetValue(), Entry()).first;
+            }
+
+            entry->type = type, entry->index = handle.index, entry->generation = handle.generation;
+            entry->category = category, entry->size = size;
+            entry->lastUse = ++tick, entry->evicted = false;
+
+            usage[static_cast<std::size_t>(category)] += size;
+            MemoryTracker::Allocate(MemoryTag::Assets, size);
+
+            return handle;
+        }
+
+        /**
+         * @brief Gets the entry of a named asset for an access, reloading it in place if it has been evicted.
+         *        Nothing is evicted here, the budgets are only enforced by Collect().
+         *        Called off the main thread (pipelined State::Update()), or on the main thread while such an
+         *        update may read the manager, the entry is only read and the reload, which rebuilds the asset
+         *        in its slot and may create GPU resources, is posted to the main thread queue.
+         */
+        Entry* Touch(AssetId id)
+        {
+            Entry *entry = map.Find(id.GetValue());
+            if (!entry) return nullptr;
+
+            if (mainQueue && (reloadsDeferred || !mainQueue->IsOwnerThread()))
+            {
+                if (entry->evicted)
+                {
+                    mainQueue->Defer([this, key = id.GetValue()]() {
+                        const Entry *current = map.Find(key);
+                        if (current && current->evicted) sources.at(key)();
+                    });
+                }
+                return entry;
+            }
+
+            if (entry->evicted)
+            {
+                sources.at(id.GetValue())();
+                entry = map.Find(id.GetValue());
+            }
+
+            entry->lastUse = ++tick;
+            return entry;
+        }
+
+        /**
+         * @brief Converts an entry into a typed handle, invalid if the type differs or the asset is evicted.
+         */
+        template <typename _Ta>
+        static Handle<_Ta> ToHandle(const Entry* entry)
+        {
+            if (!entry || entry->evicted || entry->type != AssetPoolBase::TypeIndex<_Ta>()) return {};
+            return { entry->index, entry->generation };
+        }
+
+        /**
+         * @brief Throws std::bad_cast if an existing entry holds an asset of another type.
+         */
+        template <typename _Ta>
+        static void CheckType(const Entry* entry)
+        {
+            if (entry && entry->type != AssetPoolBase::TypeIndex<_Ta>()) throw std::bad_cast();
+        }
+
+        /**
+         * @brief Converts an entry into an untyped reference, without address if the asset is evicted.
+         */
+        AssetRef ToRef(const Entry* entry) const
+        {
+            if (!entry) return {};
+            AssetPoolBase &pool = *pools[entry->type];
+            return AssetRef(entry->evicted ? nullptr : pool.GetAddress(entry->index, entry->generation), pool.Type());
+        }
+
+        /**
+         * @brief Checks if a category, or the memory as a whole, exceeds its budget.
+         */
+        bool IsOverBudget(AssetCategory category) const
+        {
+            const std::size_t c = static_cast<std::size_t>(category);
+            return (budgets[c] && usage[c] > budgets[c]) || (totalBudget && GetMemoryUsage() > totalBudget);
+        }
+
+        bool IsOverBudget() const
+        {
+            for (std::size_t c = 0; c < NumCategories; c++)
+            {
+                if (IsOverBudget(static_cast<AssetCategory>(c))) return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Destroys an asset while keeping its entry and its slot so that it can be reloaded in place.
+         */
+        void Evict(Entry& entry)
+        {
+            pools[entry.type]->Unload(entry.index, entry.generation);
+            usage[static_cast<std::size_t>(entry.category)] -= entry.size;
+            MemoryTracker::Free(MemoryTag::Assets, entry.size);
+            entry.evicted = true;
+        }
+
+        /**
+         * @brief Releases a reference by id value, for core::AssetGuard.
+         */
+        void ReleaseKey(uint64_t key)
+        {
+            Entry *entry = map.Find(key);
+            if (entry && entry->refs > 0) entry->refs--;
+        }
+
+        template <typename _Ta>
+        friend class AssetGuard;
+
+      public:
+        /**
+         * @brief Forward iterator over the named assets, as pairs of id value and core::AssetRef.
+         */
+        class Iterator
+        {
+          private:
+            using MapIterator = AssetIdMap<Entry>::Iterator<const AssetIdMap<Entry>::Slot>;
+
+            const AssetManager *manager;
+            MapIterator it, end;
+            std::pair<uint64_t, AssetRef> current;
+
+            void Update() { if (it != end) current = { it->first, manager->ToRef(&it->second) }; }
+
+          public:
+            Iterator(const AssetManager* manager, MapIterator it, MapIterator end) : manager(manager), it(it), end(end) { Update(); }
+            const std::pair<uint64_t, AssetRef>& operator*() const { return current; }
+            const std::pair<uint64_t, AssetRef>* operator->() const { return &current; }
+            Iterator& operator++() { ++it; Update(); return *this; }
+            bool operator==(const Iterator& other) const { return it == other.it; }
+            bool operator!=(const Iterator& other) const { return it != other.it; }
+        };
+
+      private:
+        Iterator IteratorAt(uint64_t key) const
+        {
+            return Iterator(this, map.FindIterator(key), map.end());
+        }
+
+      public:
+        AssetManager() = default;
+
+        ~AssetManager()
+        {
+            for (const auto& [key, entry] : map)
+            {
+                if (!entry.evicted) MemoryTracker::Free(MemoryTag::Assets, entry.size);
+            }
+        }
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        /**
+         * @brief Sets the executors used by AddAsync(). Called by core::App with its own job system and main thread queue.
+         * @param jobSystem The job system executing the decoding jobs (nullptr to decode on the calling thread).
+         * @param mainQueue The queue executing the finalizations (nullptr to finalize on the decoding thread).
+         */
+        void SetAsyncExecutors(JobSystem* jobSystem, CommandQueue* mainQueue)
+        {
+            this->jobSystem = jobSystem;
+            this->mainQueue = mainQueue;
+        }
+
+        /**
+         * @brief Defers the reloads of the evicted assets accessed from the main thread to the main thread queue.
+         *        Set by core::App while a pipelined State::Update() runs, so that the manager is only read meanwhile.
+         * @param deferred True to post the reloads, false to reload on access.
+         */
+        void SetReloadsDeferred(bool deferred)
+        {
+            reloadsDeferred = deferred;
+        }
+
+        /**
+         * @brief Loads an asset asynchronously.
+         *
+         * The decoding function is executed on a worker of the job system (file reading, image/model/audio decoding...),
+         * then the finalization function receives the decoded data on the main thread to build the asset
+         * (GPU upload...) which is finally added to the manager, replacing any asset with the same name.
+         *
+         * @tparam _Ta The type of the asset to add.
+         * @tparam _Fd Callable returning the decoded data, executed on a worker thread.
+         * @tparam _Ff Callable taking the decoded data (as rvalue) and returning the asset, executed on the main thread.
+         * @param id The name to associate with the asset.
+         * @param decode The decoding function.
+         * @param finalize The finalization function.
+         * @return A handle to query the loading status and to access the asset once ready.
+         */
+        template<typename _Ta, typename _Fd, typename _Ff>
+        AssetFuture<_Ta> AddAsync(AssetId id, _Fd&& decode, _Ff&& finalize)
+        {
+            using Data = std::decay_t<std::invoke_result_t<_Fd>>;
+            using State = typename AssetFuture<_Ta>::State;
+            using Status = typename AssetFuture<_Ta>::Status;
+
+            auto state = std::make_shared<State>();
+            const uint64_t key = id.GetValue();
+
+            {
+                std::scoped_lock lock(pendingMutex);
+                pending[key] = state;
+            }
+
+            auto complete = [this, key, state](Status status) {
+                state->status.store(status, std::memory_order_release);
+                std::scoped_lock lock(pendingMutex);
+                auto it = pending.find(key);
+                if (it != pending.end() && it->second == state) pending.erase(it);
+            };
+
+            // The name is copied as the id may be built from a temporary
+            auto job = [this, key, name = std::string(id.GetSourceName()), state, complete,
+                decode = std::forward<_Fd>(decode), finalize = std::forward<_Ff>(finalize)]() mutable
+            {
+                std::shared_ptr<Data> data;
+
+                try { data = std::make_shared<Data>(decode()); }
+                catch (...) { complete(Status::Failed); return; }
+
+                auto upload = [this, key, name = std::move(name), state, complete, data, finalize = std::move(finalize)]() mutable {
+                    try
+                    {
+                        _Ta asset(finalize(std::move(*data)));
+
+                        // As with AddOrReplace(), a previous loader must not reload its content after an eviction
+                        sources.erase(key);
+                        state->handle = Store<_Ta>(name, std::move(asset), true);
+                        state->pool = &Pool<_Ta>();
+                        complete(Status::Ready);
+                    }
+                    catch (...)
+                    {
+                        complete(Status::Failed);
+                    }
+                };
+
+                if (mainQueue) mainQueue->Post(std::move(upload));
+                else upload();
+            };
+
+            if (jobSystem) jobSystem->Run(std::move(job));
+            else job();
+
+            return AssetFuture<_Ta>(state);
+        }
+
+        /**
+         * @brief Loads an asset asynchronously without main thread finalization other than its insertion.
+         * @tparam _Ta The type of the asset to add.
+         * @tparam _Fd Callable returning the asset, executed on a worker thread.
+         * @param id The name to associate with the asset.
+         * @param decode The loading function.
+         * @return A handle to query the loading status and to access the asset once ready.
+         */
+        template<typename _Ta, typename _Fd>
+        AssetFuture<_Ta> AddAsync(AssetId id, _Fd&& decode)
+        {
+            return AddAsync<_Ta>(id, std::forward<_Fd>(decode),
+                [](std::decay_t<std::invoke_result_t<_Fd>>&& data) { return _Ta(std::move(data)); });
+        }
+
+        /**
+         * @brief Checks if an asset with the given name is being loaded asynchronously.
+         * @param id The name of the asset.
+         * @return True if the asset is still loading, false otherwise.
+         */
+        bool IsPending(AssetId id) const
+        {
+            std::scoped_lock lock(pendingMutex);
+            return pending.find(id.GetValue()) != pending.end();
+        }
+
+        /**
+         * @brief Gets the number of assets being loaded asynchronously.
+         * @return The number of pending assets.
+         */
+        std::size_t GetPendingCount() const
+        {
+            std::scoped_lock lock(pendingMutex);
+            return pending.size();
+        }
+
+        /**
+         * @brief Checks if an asset with the given name is available (present and not being reloaded).
+         * @param id The name of the asset.
+         * @return True if the asset is ready, false otherwise.
+         */
+        bool IsReady(AssetId id) const
+        {
+            return !IsPending(id) && map.Find(id.GetValue()) != nullptr;
+        }
+
+        /**
+         * @brief Gets a pointer to the asset with the given name, or a placeholder if it is not available.
+         * @tparam _Ta The type of the asset.
+         * @param id The name of the asset.
+         * @param placeholder The name of the asset to use while the requested one is missing or still loading.
+         * @return A pointer to the asset, to the placeholder, or nullptr if neither exists.
+         */
+        template<typename _Ta>
+        _Ta* GetOr(AssetId id, AssetId placeholder)
+        {
+            if (_Ta *value = Get<_Ta>(id)) return value;
+            return Get<_Ta>(placeholder);
+        }
 
       public:
         /**
          * @brief Adds a new asset to the manager with a given name and constructor arguments.
          * @tparam _Ta The type of the asset to add.
          * @tparam Args Variadic template for constructor arguments.
-         * @param name The name to associate with the asset.
+         * @param id The name to associate with the asset.
          * @param args The constructor arguments.
-         * @return A pair containing an iterator to the inserted asset and a boolean indicating success.
+         * @return A pair containing an iterator to the inserted (or existing) asset and a boolean indicating success.
          */
         template<typename _Ta, typename... Args>
-        auto Add(const std::string& name, Args... args)
+        std::pair<Iterator, bool> Add(AssetId id, Args... args)
         {
-            return map.emplace(name, Asset::Make<_Ta>(args...));
+            const bool inserted = Store<_Ta>(id, _Ta(args...), false).IsValid();
+            return { IteratorAt(id.GetValue()), inserted };
         }
 
         /**
          * @brief Adds a new asset to the manager with a given name and a pre-constructed asset.
          * @tparam _Ta The type of the asset to add.
-         * @param name The name to associate with the asset.
+         * @param id The name to associate with the asset.
          * @param asset The pre-constructed asset.
-         * @return A pair containing an iterator to the inserted asset and a boolean indicating success.
+         * @return A pair containing an iterator to the inserted (or existing) asset and a boolean indicating success.
          */
         template<typename _Ta>
-        auto Add(const std::string& name, _Ta&& asset)
+        std::pair<Iterator, bool> Add(AssetId id, _Ta&& asset)
         {
-            return map.emplace(name, Asset(asset));
+            using Type = std::decay_t<_Ta>;
+            const bool inserted = Store<Type>(id, Type(std::forward<_Ta>(asset)), false).IsValid();
+            return { IteratorAt(id.GetValue()), inserted };
         }
 
         /**
          * @brief Adds a new asset to the manager or replaces an existing one with the given name and constructor arguments.
+         *        Replacing an asset with one of the same type keeps its handles valid, the asset is no longer evictable.
          * @tparam _Ta The type of the asset to add.
          * @tparam Args Variadic template for constructor arguments.
-         * @param name The name to associate with the asset.
+         * @param id The name to associate with the asset.
          * @param args The constructor arguments.
-         * @return A pair containing an iterator to the inserted/replaced asset and a boolean indicating success.
+         * @return A pair containing an iterator to the inserted/replaced asset and a boolean indicating whether it was inserted.
          */
         template<typename _Ta, typename... Args>
-        auto AddOrReplace(const std::string& name, Args... args)
+        std::pair<Iterator, bool> AddOrReplace(AssetId id, Args... args)
         {
-            return map.insert_or_assign(name, Asset::Make<_Ta>(args...));
+            const bool inserted = map.Find(id.GetValue()) == nullptr;
+            sources.erase(id.GetValue());
+            Store<_Ta>(id, _Ta(args...), true);
+            return { IteratorAt(id.GetValue()), inserted };
         }
 
         /**
          * @brief Adds a new asset to the manager or replaces an existing one with the given name and a pre-constructed asset.
+         *        Replacing an asset with one of the same type keeps its handles valid, the asset is no longer evictable.
          * @tparam _Ta The type of the asset to add.
-         * @param name The name to associate with the asset.
+         * @param id The name to associate with the asset.
          * @param asset The pre-constructed asset.
-         * @return A pair containing an iterator to the inserted/replaced asset and a boolean indicating success.
+         * @return A pair containing an iterator to the inserted/replaced asset and a boolean indicating whether it was inserted.
+         */
+        template<typename _Ta>
+        std::pair<Iterator, bool> AddOrReplace(AssetId id, _Ta&& asset)
+        {
+            using Type = std::decay_t<_Ta>;
+            const bool inserted = map.Find(id.GetValue()) == nullptr;
+            sources.erase(id.GetValue());
+            Store<Type>(id, Type(std::forward<_Ta>(asset)), true);
+            return { IteratorAt(id.GetValue()), inserted };
+        }
+
+        /**
+         * @brief Removes an asset from the manager with the given name, invalidating its handles.
+         * @param id The name of the asset to remove.
+         */
+        void Remove(AssetId id)
+        {
+            if (Entry *entry = map.Find(id.GetValue()))
+            {
+                if (!entry->evicted) Evict(*entry);
+                pools[entry->type]->Remove(entry->index, entry->generation);
+                map.Erase(id.GetValue());
+                names.erase(id.GetValue());
+                sources.erase(id.GetValue());
+            }
+        }
+
+        /**
+         * @brief Adds or replaces an asset built by a loader, which is kept to reload the asset after an eviction.
+         *
+         * The loader is called immediately and then each time the asset is accessed by name after having been evicted.
+         * It must therefore only capture data that outlives the manager or copies (not a temporary C string).
+         *
+         * @tparam _Ta The type of the asset to add.
+         * @tparam _Fn Callable returning the asset (or a value convertible to it), executed on the main thread.
+         * @param id The name to associate with the asset.
+         * @param loader The loading function.
+         * @return A pointer to the loaded asset.
+         */
+        template<typename _Ta, typename _Fn>
+        _Ta* Load(AssetId id, _Fn&& loader)
+        {
+            std::function<void()> source = [this, name = std::string(id.GetSourceName()), loader = std::forward<_Fn>(loader)]() {
+                Store<_Ta>(name, _Ta(loader()), true);
+            };
+
+            source();
+            sources[id.GetValue()] = std::move(source);
+
+            return Get(ToHandle<_Ta>(map.Find(id.GetValue())));
+        }
+
+        /**
+         * @brief Acquires a reference to an asset, preventing its eviction until it is released.
+         *        The asset is reloaded if it had been evicted, see core::AssetGuard to release it automatically.
+         * @tparam _Ta The type of the asset.
+         * @param id The name of the asset.
+         * @return The handle of the asset, which remains valid until Release() is called, or an invalid handle
+         *         (and no reference acquired) if the asset does not exist or has a different type.
          */
         template<typename _Ta>
-        auto AddOrReplace(const std::string& name, _Ta&& asset)
+        Handle<_Ta> Acquire(AssetId id)
+        {
+            Entry *entry = Touch(id);
+            Handle<_Ta> handle = ToHandle<_Ta>(entry);
+            if (handle.IsValid()) entry->refs++;
+            return handle;
+        }
+
+        /**
+         * @brief Releases a reference acquired with Acquire(), the asset becomes evictable once all its references are released.
+         *        It is evicted by the next Collect() if the budgets are still exceeded.
+         * @param id The name of the asset.
+         */
+        void Release(AssetId id)
+        {
+            ReleaseKey(id.GetValue());
+        }
+
+        /**
+         * @brief Gets the number of references acquired on an asset.
+         * @param id The name of the asset.
+         * @return The reference count, zero if the asset does not exist.
+         */
+        uint32_t GetRefCount(AssetId id) const
+        {
+            const Entry *entry = map.Find(id.GetValue());
+            return entry ? entry->refs : 0;
+        }
+
+        /**
+         * @brief Checks if an asset is currently evicted, it will be reloaded on its next access by name.
+         * @param id The name of the asset.
+         * @return True if evicted, false if resident or if it does not exist.
+         */
+        bool IsEvicted(AssetId id) const
+        {
+            const Entry *entry = map.Find(id.GetValue());
+            return entry && entry->evicted;
+        }
+
+        /**
+         * @brief Sets the memory budget for all the categories together, enforced by the next Collect().
+         * @param bytes The budget in bytes, 0 for unlimited.
+         */
+        void SetMemoryBudget(std::size_t bytes)
+        {
+            totalBudget = bytes;
+        }
+
+        /**
+         * @brief Sets the memory budget of a category, enforced by the next Collect().
+         * @param category The category to limit.
+         * @param bytes The budget in bytes, 0 for unlimited.
+         */
+        void SetMemoryBudget(AssetCategory category, std::size_t bytes)
+        {
+            budgets[static_cast<std::size_t>(category)] = bytes;
+        }
+
+        /**
+         * @brief Gets the memory used by all the resident assets.
+         * @return The memory usage in bytes.
+         */
+        std::size_t GetMemoryUsage() const
+        {
+            std::size_t total = 0;
+            for (std::size_t bytes : usage) total += bytes;
+            return total;
+        }
+
+        /**
+         * @brief Gets the memory used by the resident assets of a category.
+         * @param category The category.
+         * @return The memory usage in bytes.
+         */
+        std::size_t GetMemoryUsage(AssetCategory category) const
+        {
+            return usage[static_cast<std::size_t>(category)];
+        }
+
+        /**
+         * @brief Evicts the least recently used unreferenced assets added with Load() until the budgets are respected.
+         *        Called by core::App at the end of each frame, pointers to the evicted assets are invalid until
+         *        they are reloaded.
+         */
+        void Collect()
+        {
+            if (!IsOverBudget()) return;
+
+            std::vector<std::pair<uint64_t, uint64_t>> candidates;   // Last use and id value
+
+            for (const auto& [key, entry] : map)
+            {
+                if (entry.refs == 0 && !entry.evicted && sources.count(key))
+                {
+                    candidates.emplace_back(entry.lastUse, key);
+                }
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+
+            for (const auto& candidate : candidates)
+            {
+                Entry &entry = *map.Find(candidate.second);
+                if (IsOverBudget(entry.category)) Evict(entry);
+                if (!IsOverBudget()) break;
+            }
+        }
+
+        /**
+         * @brief Evicts all the unreferenced assets added with Load(), regardless of the budgets.
+         *        Useful on memory warnings or when leaving a state.
+         */
+        void EvictUnused()
         {
-            return map.insert_or_assign(name, Asset(asset));
+            for (auto& [key, entry] : map)
+            {
+                if (entry.refs == 0 && !entry.evicted && sources.count(key)) Evict(entry);
+            }
         }
 
         /**
-         * @brief Removes an asset from the manager with the given name.
-         * @param name The name of the asset to remove.
+         * @brief Reserves space for a specified number of named assets.
+         * @param size The number of assets to reserve space for.
          */
-        void Remove(const std::string& name)
+        void Reserve(std::size_t size)
         {
-            auto it = map.find(name);
-            if (it != map.end()) map.erase(it);
+            map.Reserve(size);
+            names.reserve(size);
         }
 
         /**
-         * @brief Reserves space for a specified number of assets in the map.
+         * @brief Reserves space for a specified number of assets of a type.
+         * @tparam _Ta The type of the assets.
          * @param size The number of assets to reserve space for.
          */
+        template<typename _Ta>
         void Reserve(std::size_t size)
         {
-            map.reserve(size);
+            Pool<_Ta>().Reserve(size);
         }
 
         /**
-         * @brief Gets the number of assets in the manager.
+         * @brief Gets the number of named assets in the manager.
          * @return The number of assets.
          */
         std::size_t GetSize() const
         {
-            return map.size();
+            return map.Size();
+        }
+
+        /**
+         * @brief Recovers the name of an asset from its id.
+         * @param id The id of the asset.
+         * @return The name recorded when the asset was inserted, or an empty string if unknown.
+         */
+        const std::string& GetName(AssetId id) const
+        {
+            static const std::string empty;
+            auto it = names.find(id.GetValue());
+            return it != names.end() ? it->second : empty;
         }
 
         /**
          * @brief Gets the type information of the asset with the given name.
-         * @param name The name of the asset.
+         * @param id The name of the asset.
          * @return A pointer to the type information or nullptr if the asset does not exist.
          */
-        const std::type_info* GetType(const std::string& name) const
+        const std::type_info* GetType(AssetId id) const
         {
-            auto it = map.find(name);
-            if (it != map.end()) return &it->second.Type();
+            if (const Entry *entry = map.Find(id.GetValue())) return &pools[entry->type]->Type();
             return nullptr;
         }
 
         /**
-         * @brief Gets a pointer to the stored data of the asset with the given name and type.
-         * @tparam _Ta The type of the data to retrieve.
-         * @param name The name of the asset.
-         * @return A pointer to the stored data or nullptr if the asset does not exist or has a different type.
+         * @brief Gets the handle of the asset with the given name and type, to be kept instead of the name.
+         *        The asset is reloaded if it had been evicted, see Acquire() to prevent its eviction.
+         * @tparam _Ta The type of the asset.
+         * @param id The name of the asset.
+         * @return The handle, invalid if the asset does not exist or has a different type.
          */
         template<typename _Ta>
-        _Ta* Get(const std::string& name)
+        Handle<_Ta> GetHandle(AssetId id)
         {
-            auto it = map.find(name);
-            if (it != map.end()) return it->second.Get<_Ta>();
-            return nullptr;
+            return ToHandle<_Ta>(Touch(id));
         }
 
         /**
-         * @brief Gets a pointer to the stored data of the asset with the given name and type.
-         * @tparam _Ta The type of the data to retrieve.
-         * @param name The name of the asset.
-         * @return A pointer to the stored data or nullptr if the asset does not exist or has a different type.
+         * @brief Gets a pointer to the asset referenced by a handle.
+         * @tparam _Ta The type of the asset.
+         * @param handle The handle of the asset.
+         * @return A pointer to the asset, or nullptr if the handle is invalid or the asset has been removed.
          */
         template<typename _Ta>
-        const _Ta* Get(const std::string& name) const
+        _Ta* Get(Handle<_Ta> handle)
         {
-            auto it = map.find(name);
-            if (it != map.end()) return it->second.Get<_Ta>();
-            return nullptr;
+            const uint32_t type = AssetPoolBase::TypeIndex<_Ta>();
+            if (type >= pools.size() || !pools[type]) return nullptr;
+            return static_cast<AssetPool<_Ta>&>(*pools[type]).Get(handle);
         }
 
         /**
-         * @brief Gets a pointer to the asset with the given name.
-         * @param name The name of the asset.
-         * @return A pointer to the asset or nullptr if the asset does not exist.
+         * @brief Gets a pointer to the asset referenced by a handle.
+         * @tparam _Ta The type of the asset.
+         * @param handle The handle of the asset.
+         * @return A pointer to the asset, or nullptr if the handle is invalid or the asset has been removed.
          */
-        Asset* Get(const std::string& name)
+        template<typename _Ta>
+        const _Ta* Get(Handle<_Ta> handle) const
         {
-            auto it = map.find(name);
-            if (it != map.end()) return &it->second;
-            return nullptr;
+            const uint32_t type = AssetPoolBase::TypeIndex<_Ta>();
+            if (type >= pools.size() || !pools[type]) return nullptr;
+            return static_cast<const AssetPool<_Ta>&>(*pools[type]).Get(handle);
         }
 
         /**
-         * @brief Gets a pointer to the asset with the given name.
-         * @param name The name of the asset.
+         * @brief Gets a pointer to the asset with the given name and type, reloading it if it had been evicted.
+         * @tparam _Ta The type of the asset.
+         * @param id The name of the asset.
          * @return A pointer to the asset or nullptr if the asset does not exist.
+         * @throws std::bad_cast if the asset has a different type.
          */
-        const Asset* Get(const std::string& name) const
+        template<typename _Ta>
+        _Ta* Get(AssetId id)
         {
-            auto it = map.find(name);
-            if (it != map.end()) return &it->second;
-            return nullptr;
+            Entry *entry = Touch(id);
+            CheckType<_Ta>(entry);
+            return Get(ToHandle<_Ta>(entry));
+        }
+
+        /**
+         * @brief Gets a pointer to the asset with the given name and type, without reloading it if evicted.
+         * @tparam _Ta The type of the asset.
+         * @param id The name of the asset.
+         * @return A pointer to the asset or nullptr if the asset does not exist or is evicted.
+         * @throws std::bad_cast if the asset has a different type.
+         */
+        template<typename _Ta>
+        const _Ta* Get(AssetId id) const
+        {
+            const Entry *entry = map.Find(id.GetValue());
+            CheckType<_Ta>(entry);
+            return Get(ToHandle<_Ta>(entry));
+        }
+
+        /**
+         * @brief Gets an untyped reference to the asset with the given name, reloading it if it had been evicted.
+         * @param id The name of the asset.
+         * @return The reference to the asset, empty if the asset does not exist.
+         */
+        AssetRef Get(AssetId id)
+        {
+            return ToRef(Touch(id));
         }
 
         /**
-         * @brief Gets a reference to the asset with the given name.
-         * If the asset does not exist, a new empty asset is created and returned.
-         * @param name The name of the asset.
-         * @return A reference to the asset.
+         * @brief Gets an untyped reference to the asset with the given name, without reloading it if evicted.
+         * @param id The name of the asset.
+         * @return The reference to the asset, empty if the asset does not exist or is evicted.
          */
-        Asset& operator[](const std::string& name)
+        AssetRef Get(AssetId id) const
         {
-            auto it = map.find(name);
-            if (it != map.end()) return it->second;
-            return map.emplace(name, Asset()).first->second;
+            return ToRef(map.Find(id.GetValue()));
         }
 
         /**
-         * @brief Returns an iterator pointing to the beginning of the asset manager's map.
+         * @brief Gets an untyped reference to the asset with the given name, see Get(AssetId).
+         * @param id The name of the asset.
+         * @return The reference to the asset, empty if the asset does not exist.
+         */
+        AssetRef operator[](AssetId id)
+        {
+            return Get(id);
+        }
+
+        /**
+         * @brief Gets the pool storing all the assets of a type, to iterate over them contiguously.
+         * @tparam _Ta The type of the assets.
+         * @return A pointer to the pool, or nullptr if no asset of this type has ever been added.
+         */
+        template<typename _Ta>
+        AssetPool<_Ta>* GetPool()
+        {
+            const uint32_t type = AssetPoolBase::TypeIndex<_Ta>();
+            if (type >= pools.size() || !pools[type]) return nullptr;
+            return static_cast<AssetPool<_Ta>*>(pools[type].get());
+        }
+
+        /**
+         * @brief Returns an iterator pointing to the first named asset.
          * @return An iterator pointing to the beginning.
          */
-        auto begin() { return map.begin(); }
+        Iterator begin() const { return Iterator(this, map.begin(), map.end()); }
 
         /**
-         * @brief Returns an iterator pointing to the end of the asset manager's map.
+         * @brief Returns an iterator pointing past the last named asset.
          * @return An iterator pointing to the end.
          */
-        auto end() { return map.end(); }
+        Iterator end() const { return Iterator(this, map.end(), map.end()); }
+    };
+
+    /**
+     * @brief The AssetGuard class holds a reference acquired on an asset of core::AssetManager and releases it
+     *        on destruction, keeping the asset resident (and its pointers valid) for the lifetime of the guard.
+     * @tparam _Ta The type of the asset.
+     */
+    template <typename _Ta>
+    class AssetGuard
+    {
+      private:
+        AssetManager *manager = nullptr;    ///< Manager the reference was acquired from, null if none.
+        uint64_t key = 0;                   ///< Id value of the asset.
+        Handle<_Ta> handle;                 ///< Handle of the asset.
+
+      public:
+        AssetGuard() = default;
+
+        /**
+         * @brief Acquires a reference to an asset, see AssetManager::Acquire().
+         * @param manager The manager of the asset, which must outlive the guard.
+         * @param id The name of the asset.
+         */
+        AssetGuard(AssetManager& manager, AssetId id) : key(id.GetValue()), handle(manager.Acquire<_Ta>(id))
+        {
+            if (handle.IsValid()) this->manager = &manager;
+        }
+
+        ~AssetGuard()
+        {
+            Reset();
+        }
+
+        AssetGuard(const AssetGuard&) = delete;
+        AssetGuard& operator=(const AssetGuard&) = delete;
+
+        AssetGuard(AssetGuard&& other) noexcept
+        : manager(std::exchange(other.manager, nullptr)), key(other.key), handle(other.handle) { }
+
+        AssetGuard& operator=(AssetGuard&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                manager = std::exchange(other.manager, nullptr);
+                key = other.key, handle = other.handle;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Releases the reference, if any.
+         */
+        void Reset()
+        {
+            if (manager) std::exchange(manager, nullptr)->ReleaseKey(key);
+        }
+
+        /**
+         * @brief Gets a pointer to the asset.
+         * @return The asset, or nullptr if no reference is held or the asset has been removed.
+         */
+        _Ta* Get() const
+        {
+            return manager ? manager->Get(handle) : nullptr;
+        }
+
+        _Ta* operator->() const { return Get(); }
+        _Ta& operator*() const { return *Get(); }
+
+        /**
+         * @brief Checks if a reference is held.
+         */
+        explicit operator bool() const
+        {
+            return manager != nullptr;
+        }
     };
 
 }}
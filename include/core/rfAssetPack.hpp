@@ -0,0 +1,291 @@
+#ifndef RAYFLEX_CORE_ASSET_PACK_HPP
+#define RAYFLEX_CORE_ASSET_PACK_HPP
+
+#include "./rfAssetId.hpp"
+
+#include <raylib.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The AssetPack class gives access to the entries of an asset archive mapped in memory.
+     *
+     * The archive is made of a header, a table of contents sorted by AssetId hash, a table of null-terminated
+     * names and the data of the entries, each aligned on AssetPack::Alignment bytes. All values are little endian.
+     *
+     * Opening a pack only maps the file, the entries are paged in by the OS when they are accessed,
+     * uncompressed entries being then read in place without any copy. Load() and the LoadXXX() helpers
+     * are thread-safe and can be called from the workers of core::JobSystem (e.g. from AssetManager::AddAsync()),
+     * the decompression of compressed entries being thus done off the main thread.
+     *
+     * Packs are written with AssetPack::Build() or the 'rayflex_pack' command line tool.
+     */
+    class AssetPack
+    {
+      public:
+        static constexpr uint32_t Magic = 0x4B504652;   ///< "RFPK" read as a little endian integer.
+        static constexpr uint32_t Version = 1;          ///< Version of the format.
+        static constexpr uint32_t Alignment = 64;       ///< Alignment of the entries data in the file.
+
+        /**
+         * @brief Compression method of an entry.
+         */
+        enum class Compression : uint32_t
+        {
+            None = 0,       ///< Stored as is, read in place.
+            Deflate = 1     ///< Compressed with raylib's CompressData(), decompressed on load.
+        };
+
+        /**
+         * @brief Header at the beginning of the file.
+         */
+        struct Header
+        {
+            uint32_t magic;             ///< Must be AssetPack::Magic.
+            uint32_t version;           ///< Must be AssetPack::Version.
+            uint32_t entryCount;        ///< Number of entries in the table of contents.
+            uint32_t reserved;          ///< Unused, zero.
+            uint64_t tocOffset;         ///< Offset of the table of contents.
+            uint64_t namesOffset;       ///< Offset of the table of names.
+        };
+
+        /**
+         * @brief Entry of the table of contents.
+         */
+        struct Entry
+        {
+            uint64_t hash;              ///< AssetId hash of the name, the table is sorted on it.
+            uint64_t offset;            ///< Offset of the data in the file.
+            uint64_t size;              ///< Size of the data as stored in the file.
+            uint64_t rawSize;           ///< Size of the data once decompressed.
+            uint32_t nameOffset;        ///< Offset of the name in the table of names.
+            uint32_t nameLength;        ///< Length of the name, without the null terminator.
+            Compression compression;    ///< Compression method of the data.
+            uint32_t reserved;          ///< Unused, zero.
+        };
+
+        /**
+         * @brief Data of a loaded entry, either a view of the mapped file or a decompressed buffer owned by the blob.
+         *        A view remains valid as long as the pack stays open.
+         */
+        class Blob
+        {
+          private:
+            std::unique_ptr<unsigned char, void(*)(void*)> owned{nullptr, [](void*){}};  ///< Decompressed data, if any.
+            const unsigned char *data = nullptr;    ///< Data of the entry.
+            std::size_t size = 0;                   ///< Size of the data.
+
+          public:
+            Blob() = default;
+            Blob(const unsigned char* data, std::size_t size) : data(data), size(size) { }
+            Blob(unsigned char* data, std::size_t size, void(*deleter)(void*)) : owned(data, deleter), data(data), size(size) { }
+
+            const unsigned char* GetData() const { return data; }
+            std::size_t GetSize() const { return size; }
+            int GetIntSize() const { return static_cast<int>(size); }
+
+            /**
+             * @brief Checks if the blob holds the data of an entry.
+             * @return True if valid, false if the entry was not found or could not be decompressed.
+             */
+            bool IsValid() const { return data != nullptr; }
+
+            /**
+             * @brief Checks if the blob owns its data or is a view of the mapped pack.
+             * @return True if the data has been decompressed into a buffer owned by the blob.
+             */
+            bool IsOwned() const { return owned != nullptr; }
+
+            explicit operator bool() const { return IsValid(); }
+        };
+
+        /**
+         * @brief Entry to write with Build().
+         */
+        struct Source
+        {
+            std::string name;                   ///< Name of the entry, hashed as an AssetId.
+            std::vector<unsigned char> data;    ///< Data of the entry.
+            bool compress = false;              ///< Compresses the entry, kept uncompressed if it does not reduce its size.
+        };
+
+      private:
+        const unsigned char *base = nullptr;    ///< Beginning of the mapped file.
+        std::size_t size = 0;                   ///< Size of the mapped file.
+        const Header *header = nullptr;         ///< Header of the pack.
+        const Entry *toc = nullptr;             ///< Table of contents.
+        const char *names = nullptr;            ///< Table of names.
+        void *mapping = nullptr;                ///< Platform handle of the mapping, if any.
+
+      public:
+        AssetPack() = default;
+
+        /**
+         * @brief Constructs an AssetPack and opens the given file, see IsOpen() to check the result.
+         * @param fileName The path of the pack.
+         */
+        explicit AssetPack(const std::string& fileName)
+        {
+            Open(fileName);
+        }
+
+        ~AssetPack()
+        {
+            Close();
+        }
+
+        AssetPack(const AssetPack&) = delete;
+        AssetPack& operator=(const AssetPack&) = delete;
+
+        AssetPack(AssetPack&& other) noexcept;
+        AssetPack& operator=(AssetPack&& other) noexcept;
+
+        /**
+         * @brief Maps a pack into memory and validates its table of contents. Any previously opened pack is closed.
+         * @param fileName The path of the pack.
+         * @return True if the pack was opened successfully, false otherwise.
+         */
+        bool Open(const std::string& fileName);
+
+        /**
+         * @brief Unmaps the pack, invalidating all the views returned by Load().
+         */
+        void Close();
+
+        /**
+         * @brief Checks if a pack is open.
+         * @return True if open, false otherwise.
+         */
+        bool IsOpen() const
+        {
+            return base != nullptr;
+        }
+
+        /**
+         * @brief Gets the number of entries in the pack.
+         * @return The number of entries.
+         */
+        uint32_t GetEntryCount() const
+        {
+            return header ? header->entryCount : 0;
+        }
+
+        /**
+         * @brief Finds an entry by name (binary search on the hash).
+         * @param id The name of the entry.
+         * @return A pointer to the entry, or nullptr if not found.
+         */
+        const Entry* Find(AssetId id) const;
+
+        /**
+         * @brief Checks if the pack contains an entry.
+         * @param id The name of the entry.
+         * @return True if found, false otherwise.
+         */
+        bool Contains(AssetId id) const
+        {
+            return Find(id) != nullptr;
+        }
+
+        /**
+         * @brief Gets the name of an entry.
+         * @param entry The entry.
+         * @return The null-terminated name.
+         */
+        const char* GetName(const Entry& entry) const
+        {
+            return names + entry.nameOffset;
+        }
+
+        /**
+         * @brief Gets the file type of an entry as expected by raylib's from-memory loaders (e.g. ".png").
+         * @param entry The entry.
+         * @return The extension of the name including the dot, or an empty string if none.
+         */
+        const char* GetFileType(const Entry& entry) const;
+
+        /**
+         * @brief Gets the data of an entry, decompressing it if needed. Thread-safe.
+         * @param entry The entry.
+         * @return The data, invalid if the decompression failed.
+         */
+        Blob Load(const Entry& entry) const;
+
+        /**
+         * @brief Gets the data of an entry, decompressing it if needed. Thread-safe.
+         * @param id The name of the entry.
+         * @return The data, invalid if the entry was not found or the decompression failed.
+         */
+        Blob Load(AssetId id) const
+        {
+            const Entry *entry = Find(id);
+            return entry ? Load(*entry) : Blob();
+        }
+
+        /**
+         * @brief Loads an image from an entry, cooked (see rfCooked.hpp) or decoded with LoadImageFromMemory(). Thread-safe.
+         * @param id The name of the entry.
+         * @return The image, with null data on failure.
+         */
+        ::Image LoadImage(AssetId id) const;
+
+        /**
+         * @brief Loads a texture from an entry. Must be called from the thread owning the GL context.
+         *        Uncompressed cooked textures are uploaded straight from the mapped pack.
+         * @param id The name of the entry.
+         * @return The texture, with id zero on failure.
+         */
+        ::Texture LoadTexture(AssetId id) const;
+
+        /**
+         * @brief Loads a model from a cooked entry (see LoadCookedModel()).
+         * @param id The name of the entry.
+         * @param upload Uploads the meshes to the GPU, in which case the GL context is required.
+         * @return The model, with no mesh on failure.
+         */
+        ::Model LoadModel(AssetId id, bool upload = true) const;
+
+        /**
+         * @brief Loads a wave from an entry with LoadWaveFromMemory(). Thread-safe.
+         * @param id The name of the entry.
+         * @return The wave, with null data on failure.
+         */
+        ::Wave LoadWave(AssetId id) const;
+
+        /**
+         * @brief Loads a music stream from an entry with LoadMusicStreamFromMemory().
+         *        The stream reads the mapped data while playing, so the entry must be uncompressed
+         *        and the pack must stay open until the music is unloaded.
+         * @param id The name of the entry.
+         * @return The music, with null context on failure.
+         */
+        ::Music LoadMusic(AssetId id) const;
+
+        /**
+         * @brief Returns an iterator pointing to the first entry of the table of contents.
+         * @return An iterator pointing to the beginning.
+         */
+        const Entry* begin() const { return toc; }
+
+        /**
+         * @brief Returns an iterator pointing past the last entry of the table of contents.
+         * @return An iterator pointing to the end.
+         */
+        const Entry* end() const { return toc + GetEntryCount(); }
+
+        /**
+         * @brief Writes a pack containing the given entries.
+         * @param fileName The path of the pack to write.
+         * @param sources The entries, their names must be unique (and so their hashes).
+         * @return True if the pack was written successfully, false otherwise.
+         */
+        static bool Build(const std::string& fileName, std::vector<Source> sources);
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_ASSET_PACK_HPP
@@ -0,0 +1,405 @@
+#ifndef RAYFLEX_CORE_ASSET_POOL_HPP
+#define RAYFLEX_CORE_ASSET_POOL_HPP
+
+#include <typeinfo>
+#include <utility>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <new>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The Handle struct is a weak reference to an asset stored in an AssetPool.
+     *
+     * It is made of the index of a slot and the generation of this slot when the asset was inserted,
+     * the generation being incremented each time the slot is freed, so that a handle to a removed asset
+     * can never access the asset inserted after it in the same slot.
+     * A default constructed handle is invalid (generation zero is never used).
+     *
+     * @tparam T The type of the referenced asset.
+     */
+    template <typename T>
+    struct Handle
+    {
+        uint32_t index = 0;         ///< Index of the slot in the pool.
+        uint32_t generation = 0;    ///< Generation of the slot, zero for an invalid handle.
+
+        /**
+         * @brief Checks if the handle has been assigned, it can still be stale.
+         * @return True if the handle refers to a slot, false otherwise.
+         */
+        bool IsValid() const
+        {
+            return generation != 0;
+        }
+
+        bool operator==(const Handle& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const Handle& other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief The AssetPoolBase class is the type-erased interface of AssetPool used by core::AssetManager.
+     */
+    class AssetPoolBase
+    {
+      private:
+        static uint32_t NextTypeIndex()
+        {
+            static std::atomic<uint32_t> next{0};
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+      public:
+        virtual ~AssetPoolBase() = default;
+
+        /**
+         * @brief Gets a small unique index for the given type, used to find its pool without RTTI.
+         * @tparam T The type of asset.
+         * @return The index of the type, assigned on the first call.
+         */
+        template <typename T>
+        static uint32_t TypeIndex()
+        {
+            static const uint32_t index = NextTypeIndex();
+            return index;
+        }
+
+        /**
+         * @brief Removes the asset stored in a slot.
+         * @param index The index of the slot.
+         * @param generation The expected generation of the slot.
+         * @return True if an asset was removed, false if the slot was stale.
+         */
+        virtual bool Remove(uint32_t index, uint32_t generation) = 0;
+
+        /**
+         * @brief Destroys the asset stored in a slot but keeps the slot and its generation, see AssetPool::Restore().
+         * @param index The index of the slot.
+         * @param generation The expected generation of the slot.
+         * @return True if an asset was destroyed, false if the slot was stale or already unloaded.
+         */
+        virtual bool Unload(uint32_t index, uint32_t generation) = 0;
+
+        /**
+         * @brief Gets the address of the asset stored in a slot, for the untyped access of core::AssetManager.
+         * @param index The index of the slot.
+         * @param generation The expected generation of the slot.
+         * @return The address of the asset, or nullptr if the slot is stale.
+         */
+        virtual void* GetAddress(uint32_t index, uint32_t generation) = 0;
+
+        /**
+         * @brief Gets the number of assets in the pool.
+         * @return The number of assets.
+         */
+        virtual std::size_t Size() const = 0;
+
+        /**
+         * @brief Gets the type information of the stored assets.
+         * @return The type information.
+         */
+        virtual const std::type_info& Type() const = 0;
+    };
+
+    /**
+     * @brief The AssetPool class stores assets of a single type in stable storage (slot map).
+     *
+     * The assets are constructed in place in fixed-size pages which are never moved nor freed before the pool,
+     * each slot of the pages being referenced by a generation-checked handle. Accessing an asset through
+     * a handle is thus an array read, a generation check and an offset in a page.
+     * The slots in use are also listed in a packed array, so that iterating over the pool only visits assets.
+     *
+     * The address of an asset never changes while it is in the pool: pointers to an asset remain valid
+     * until this asset is removed or unloaded (or the pool destroyed), whatever is inserted or removed around it.
+     * Handles remain the safe way to keep a reference to an asset, as they detect its removal.
+     *
+     * An asset can also be unloaded, its slot being kept with the same generation until a new asset is restored
+     * in it (see Unload() and Restore()), so that its handles and its address remain the same once reloaded.
+     *
+     * @tparam T The type of the stored assets (move constructible and move assignable).
+     */
+    template <typename T>
+    class AssetPool : public AssetPoolBase
+    {
+      private:
+        static constexpr uint32_t PageSize = 64;    ///< Number of slots per page.
+
+        /**
+         * @brief Uninitialized storage for one asset.
+         */
+        struct Storage
+        {
+            alignas(T) unsigned char bytes[sizeof(T)];
+        };
+
+        /**
+         * @brief Fixed block of storage, allocated once and never moved.
+         */
+        struct Page
+        {
+            Storage values[PageSize];
+        };
+
+        /**
+         * @brief Entry of the indirection table.
+         */
+        struct Slot
+        {
+            uint32_t dense = 0;         ///< Position of the slot in the packed list of slots in use.
+            uint32_t generation = 1;    ///< Current generation of the slot, incremented when the slot is freed.
+            bool used = false;          ///< Flag indicating whether an asset is constructed in the slot (false if free or unloaded).
+        };
+
+        /**
+         * @brief Forward iterator over the assets of the pool, in no particular order.
+         */
+        template <typename P, typename V>
+        class Iterator
+        {
+          private:
+            P *pool;
+            std::size_t position;
+
+          public:
+            Iterator(P* pool, std::size_t position) : pool(pool), position(position) { }
+            V& operator*() const { return *pool->Value(pool->owners[position]); }
+            V* operator->() const { return pool->Value(pool->owners[position]); }
+            Iterator& operator++() { position++; return *this; }
+            bool operator==(const Iterator& other) const { return position == other.position; }
+            bool operator!=(const Iterator& other) const { return position != other.position; }
+        };
+
+      private:
+        std::vector<std::unique_ptr<Page>> pages;   ///< Storage of the assets, slot i is in page i / PageSize.
+        std::vector<Slot> slots;                    ///< Indirection table indexed by the handles.
+        std::vector<uint32_t> owners;               ///< Indices of the slots in use, packed.
+        std::vector<uint32_t> freeSlots;            ///< Indices of the free slots.
+
+      private:
+        T* Value(uint32_t index)
+        {
+            return std::launder(reinterpret_cast<T*>(pages[index / PageSize]->values[index % PageSize].bytes));
+        }
+
+        const T* Value(uint32_t index) const
+        {
+            return std::launder(reinterpret_cast<const T*>(pages[index / PageSize]->values[index % PageSize].bytes));
+        }
+
+        /**
+         * @brief Finds an allocated slot, the asset being constructed in it or unloaded.
+         */
+        Slot* FindSlot(uint32_t index, uint32_t generation)
+        {
+            return (index < slots.size() && slots[index].generation == generation) ? &slots[index] : nullptr;
+        }
+
+        const Slot* FindSlot(uint32_t index, uint32_t generation) const
+        {
+            return (index < slots.size() && slots[index].generation == generation) ? &slots[index] : nullptr;
+        }
+
+        const Slot* FindUsed(uint32_t index, uint32_t generation) const
+        {
+            const Slot *slot = FindSlot(index, generation);
+            return (slot && slot->used) ? slot : nullptr;
+        }
+
+        void Construct(uint32_t index, T&& value)
+        {
+            new (Value(index)) T(std::move(value));
+            owners.push_back(index);
+
+            Slot &slot = slots[index];
+            slot.dense = static_cast<uint32_t>(owners.size() - 1);
+            slot.used = true;
+        }
+
+        void Destroy(uint32_t index)
+        {
+            Slot &slot = slots[index];
+            Value(index)->~T();
+
+            // Only the index of the last slot in use is moved, the assets stay in place
+            const uint32_t last = owners.back();
+            owners[slot.dense] = last;
+            slots[last].dense = slot.dense;
+            owners.pop_back();
+
+            slot.used = false;
+        }
+
+      public:
+        AssetPool() = default;
+
+        /**
+         * @brief Destructor, destroys the assets still in the pool.
+         */
+        ~AssetPool()
+        {
+            for (uint32_t index : owners) Value(index)->~T();
+        }
+
+        AssetPool(const AssetPool&) = delete;
+        AssetPool& operator=(const AssetPool&) = delete;
+
+        /**
+         * @brief Inserts an asset into the pool, without moving the assets already stored.
+         * @param value The asset to insert.
+         * @return The handle to the inserted asset.
+         */
+        Handle<T> Insert(T&& value)
+        {
+            uint32_t index;
+
+            if (!freeSlots.empty())
+            {
+                index = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else
+            {
+                index = static_cast<uint32_t>(slots.size());
+                if (index / PageSize >= pages.size()) pages.push_back(std::make_unique<Page>());
+                slots.emplace_back();
+            }
+
+            Construct(index, std::move(value));
+
+            return { index, slots[index].generation };
+        }
+
+        /**
+         * @brief Constructs an asset in the slot of an unloaded one, at the same address and with the same handle.
+         * @param handle The handle of the unloaded asset.
+         * @param value The asset to restore.
+         * @return True if the asset was restored, false if the handle is stale or the slot is not unloaded.
+         */
+        bool Restore(Handle<T> handle, T&& value)
+        {
+            const Slot *slot = FindSlot(handle.index, handle.generation);
+            if (!slot || slot->used) return false;
+
+            Construct(handle.index, std::move(value));
+            return true;
+        }
+
+        /**
+         * @brief Gets a pointer to the asset referenced by a handle.
+         * @param handle The handle of the asset.
+         * @return A pointer to the asset, or nullptr if the handle is stale or invalid.
+         */
+        T* Get(Handle<T> handle)
+        {
+            return FindUsed(handle.index, handle.generation) ? Value(handle.index) : nullptr;
+        }
+
+        /**
+         * @brief Gets a pointer to the asset referenced by a handle.
+         * @param handle The handle of the asset.
+         * @return A pointer to the asset, or nullptr if the handle is stale or invalid.
+         */
+        const T* Get(Handle<T> handle) const
+        {
+            return FindUsed(handle.index, handle.generation) ? Value(handle.index) : nullptr;
+        }
+
+        void* GetAddress(uint32_t index, uint32_t generation) override
+        {
+            return FindUsed(index, generation) ? Value(index) : nullptr;
+        }
+
+        /**
+         * @brief Checks if a handle refers to an asset of the pool.
+         * @param handle The handle to check.
+         * @return True if the asset exists, false if the handle is stale or invalid.
+         */
+        bool Contains(Handle<T> handle) const
+        {
+            return FindUsed(handle.index, handle.generation) != nullptr;
+        }
+
+        /**
+         * @brief Removes the asset referenced by a handle, invalidating all the handles and pointers to it.
+         *        The slot of an unloaded asset is freed the same way.
+         * @param handle The handle of the asset.
+         * @return True if an asset was removed, false if the handle is stale or invalid.
+         */
+        bool Remove(Handle<T> handle)
+        {
+            return Remove(handle.index, handle.generation);
+        }
+
+        bool Remove(uint32_t index, uint32_t generation) override
+        {
+            Slot *slot = FindSlot(index, generation);
+            if (!slot) return false;
+
+            if (slot->used) Destroy(index);
+
+            // Zero is skipped on wrap around as it marks invalid handles
+            if (++slot->generation == 0) slot->generation = 1;
+            freeSlots.push_back(index);
+
+            return true;
+        }
+
+        bool Unload(uint32_t index, uint32_t generation) override
+        {
+            if (!FindUsed(index, generation)) return false;
+
+            Destroy(index);
+            return true;
+        }
+
+        /**
+         * @brief Gets the handle of the asset at the given position of the iteration.
+         * @param position The position of the asset, in the range [0, Size()).
+         * @return The handle of the asset.
+         */
+        Handle<T> GetHandle(std::size_t position) const
+        {
+            const uint32_t index = owners[position];
+            return { index, slots[index].generation };
+        }
+
+        /**
+         * @brief Reserves space for the given number of assets.
+         * @param size The number of assets to reserve space for.
+         */
+        void Reserve(std::size_t size)
+        {
+            slots.reserve(size);
+            owners.reserve(size);
+
+            while (pages.size() * PageSize < size)
+            {
+                pages.push_back(std::make_unique<Page>());
+            }
+        }
+
+        std::size_t Size() const override
+        {
+            return owners.size();
+        }
+
+        const std::type_info& Type() const override
+        {
+            return typeid(T);
+        }
+
+        /**
+         * @brief Iterators over the assets, in no particular order.
+         */
+        auto begin() { return Iterator<AssetPool, T>(this, 0); }
+        auto end() { return Iterator<AssetPool, T>(this, owners.size()); }
+        auto begin() const { return Iterator<const AssetPool, const T>(this, 0); }
+        auto end() const { return Iterator<const AssetPool, const T>(this, owners.size()); }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_ASSET_POOL_HPP
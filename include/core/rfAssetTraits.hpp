@@ -0,0 +1,167 @@
+#ifndef RAYFLEX_CORE_ASSET_TRAITS_HPP
+#define RAYFLEX_CORE_ASSET_TRAITS_HPP
+
+#include <raylib.h>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief Memory categories used by core::AssetManager for the accounting and the budgets.
+     */
+    enum class AssetCategory : uint8_t
+    {
+        Texture,        ///< Textures, render textures and images.
+        Mesh,           ///< Meshes and models.
+        Audio,          ///< Sounds, waves and musics.
+        Other,          ///< Everything else.
+        Count           ///< Number of categories.
+    };
+
+    /**
+     * @brief The AssetTraits struct tells core::AssetManager the category and the memory footprint of an asset type.
+     *
+     * By default an asset is of category AssetCategory::Other and weighs sizeof(T),
+     * specialize it for your own types to account for the memory they own.
+     * Specializations for raylib types (and the raylib-cpp classes deriving from them) are provided.
+     *
+     * @tparam T The type of asset.
+     */
+    template <typename T, typename = void>
+    struct AssetTraits
+    {
+        static constexpr AssetCategory category = AssetCategory::Other;
+        static std::size_t GetSize(const T&) { return sizeof(T); }
+    };
+
+    /**
+     * @brief Computes the size of pixel data including its mipmap chain.
+     * @param width The width of the first level.
+     * @param height The height of the first level.
+     * @param mipmaps The number of levels.
+     * @param format The pixel format.
+     * @return The size in bytes.
+     */
+    inline std::size_t GetPixelDataSizeMipmaps(int width, int height, int mipmaps, int format)
+    {
+        std::size_t size = 0;
+
+        for (int i = 0; i < (mipmaps > 0 ? mipmaps : 1); i++)
+        {
+            size += static_cast<std::size_t>(GetPixelDataSize(width, height, format));
+            width = width > 1 ? width / 2 : 1, height = height > 1 ? height / 2 : 1;
+        }
+
+        return size;
+    }
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::Texture, T>>>
+    {
+        static constexpr AssetCategory category = AssetCategory::Texture;
+
+        static std::size_t GetSize(const ::Texture& texture)
+        {
+            return GetPixelDataSizeMipmaps(texture.width, texture.height, texture.mipmaps, texture.format);
+        }
+    };
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::RenderTexture, T>>>
+    {
+        static constexpr AssetCategory category = AssetCategory::Texture;
+
+        static std::size_t GetSize(const ::RenderTexture& target)
+        {
+            // The depth buffer is assumed to be a 32 bits renderbuffer
+            return AssetTraits<::Texture>::GetSize(target.texture)
+                + static_cast<std::size_t>(target.depth.width) * target.depth.height * 4;
+        }
+    };
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::Image, T>>>
+    {
+        static constexpr AssetCategory category = AssetCategory::Texture;
+
+        static std::size_t GetSize(const ::Image& image)
+        {
+            return image.data ? GetPixelDataSizeMipmaps(image.width, image.height, image.mipmaps, image.format) : 0;
+        }
+    };
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::Mesh, T>>>
+    {
+        static constexpr AssetCategory category = AssetCategory::Mesh;
+
+        static std::size_t GetSize(const ::Mesh& mesh)
+        {
+            std::size_t vertexSize = 0;
+
+            if (mesh.vertices) vertexSize += 3 * sizeof(float);
+            if (mesh.texcoords) vertexSize += 2 * sizeof(float);
+            if (mesh.texcoords2) vertexSize += 2 * sizeof(float);
+            if (mesh.normals) vertexSize += 3 * sizeof(float);
+            if (mesh.tangents) vertexSize += 4 * sizeof(float);
+            if (mesh.colors) vertexSize += 4 * sizeof(unsigned char);
+            if (mesh.animVertices) vertexSize += 3 * sizeof(float);
+            if (mesh.animNormals) vertexSize += 3 * sizeof(float);
+            if (mesh.boneIds) vertexSize += 4 * sizeof(unsigned char);
+            if (mesh.boneWeights) vertexSize += 4 * sizeof(float);
+
+            std::size_t size = vertexSize * mesh.vertexCount;
+            if (mesh.indices) size += 3 * sizeof(unsigned short) * mesh.triangleCount;
+
+            return size;
+        }
+    };
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::Model, T>>>
+    {
+        static constexpr AssetCategory category = AssetCategory::Mesh;
+
+        static std::size_t GetSize(const ::Model& model)
+        {
+            std::size_t size = 0;
+            for (int i = 0; i < model.meshCount; i++) size += AssetTraits<::Mesh>::GetSize(model.meshes[i]);
+            return size;
+        }
+    };
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::Sound, T>>>
+    {
+        static constexpr AssetCategory category = AssetCategory::Audio;
+
+        static std::size_t GetSize(const ::Sound& sound)
+        {
+            return static_cast<std::size_t>(sound.frameCount) * sound.stream.channels * (sound.stream.sampleSize / 8);
+        }
+    };
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::Wave, T>>>
+    {
+        static constexpr AssetCategory category = AssetCategory::Audio;
+
+        static std::size_t GetSize(const ::Wave& wave)
+        {
+            return wave.data ? static_cast<std::size_t>(wave.frameCount) * wave.channels * (wave.sampleSize / 8) : 0;
+        }
+    };
+
+    template <typename T>
+    struct AssetTraits<T, std::enable_if_t<std::is_base_of_v<::Music, T>>>
+    {
+        // Musics are streamed, only the stream buffers are resident
+        static constexpr AssetCategory category = AssetCategory::Audio;
+        static std::size_t GetSize(const ::Music&) { return sizeof(::Music); }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_ASSET_TRAITS_HPP
@@ -0,0 +1,81 @@
+#ifndef RAYFLEX_CORE_BENCHMARK_HPP
+#define RAYFLEX_CORE_BENCHMARK_HPP
+
+#include "./rfProfiler.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief Defines what is executed for each frame of core::App::Benchmark().
+     */
+    enum class BenchmarkMode
+    {
+        Present,        ///< Full frame: update, draw into the renderer and present to the window (uncapped).
+        Offscreen,      ///< Update and draw into the renderer only, nothing is presented to the window.
+        NoDraw          ///< Update only, no rendering at all (usable without any GPU).
+    };
+
+    /**
+     * @brief The BenchmarkReport struct contains the results of a core::App::Benchmark() run.
+     *        All times are in milliseconds.
+     */
+    struct BenchmarkReport
+    {
+        /**
+         * @brief Struct representing the timings of a profiled phase.
+         */
+        struct Phase
+        {
+            std::string name;           ///< Name of the profiled scope.
+            Profiler::Stats stats;      ///< Statistics of the scope over all the frames of the run it was recorded in.
+        };
+
+        std::string state;              ///< Name of the benchmarked state.
+        BenchmarkMode mode = BenchmarkMode::NoDraw; ///< Mode actually used for the run.
+        uint32_t frames = 0;            ///< Number of frames executed.
+        float dt = 0;                   ///< Forced delta time in seconds.
+
+        float total = 0;                ///< Total time of the run.
+        float min = 0;                  ///< Fastest frame.
+        float avg = 0;                  ///< Average frame time.
+        float p50 = 0;                  ///< Median frame time.
+        float p90 = 0;                  ///< 90th percentile of the frame time.
+        float p99 = 0;                  ///< 99th percentile of the frame time.
+        float max = 0;                  ///< Slowest frame.
+
+        std::vector<Phase> phases;      ///< Per-phase timings reported by the core::Profiler.
+
+        /**
+         * @brief Computes the frame time statistics from the measured frame times.
+         * @param frameTimes The duration of each frame in milliseconds.
+         */
+        void ComputeFrameStats(std::vector<float> frameTimes);
+
+        /**
+         * @brief Adds the statistics of a profiled phase computed from its durations.
+         * @param name The name of the profiled scope.
+         * @param times The time spent in the scope for each frame it was recorded in, in milliseconds.
+         */
+        void AddPhase(std::string name, std::vector<float> times);
+
+        /**
+         * @brief Serializes the report as a JSON object.
+         * @return The JSON string.
+         */
+        std::string ToJSON() const;
+
+        /**
+         * @brief Writes the report as JSON into the given file.
+         * @param fileName The path of the file to write.
+         * @return True if the file was written successfully, false otherwise.
+         */
+        bool Save(const std::string& fileName) const;
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_BENCHMARK_HPP
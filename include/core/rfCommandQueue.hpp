@@ -0,0 +1,131 @@
+#ifndef RAYFLEX_CORE_COMMAND_QUEUE_HPP
+#define RAYFLEX_CORE_COMMAND_QUEUE_HPP
+
+#include <type_traits>
+#include <functional>
+#include <future>
+#include <thread>
+#include <memory>
+#include <chrono>
+#include <deque>
+#include <mutex>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The CommandQueue class allows any thread to post closures executed later by the thread owning the queue.
+     *
+     * It is used by core::App to marshal work requiring the GL context (texture/mesh upload, shader compilation...)
+     * back to the main thread, where the queue is drained between frames within a time budget.
+     */
+    class CommandQueue
+    {
+      private:
+        std::deque<std::function<void()>> commands;     ///< Pending commands.
+        mutable std::mutex mutex;                       ///< Protects the pending commands.
+        std::thread::id ownerThread;                    ///< Thread executing the commands.
+
+      public:
+        /**
+         * @brief Constructs a CommandQueue owned by the calling thread.
+         */
+        CommandQueue() : ownerThread(std::this_thread::get_id())
+        { }
+
+        CommandQueue(const CommandQueue&) = delete;
+        CommandQueue& operator=(const CommandQueue&) = delete;
+
+        /**
+         * @brief Checks if the calling thread is the thread owning the queue.
+         * @return True if called from the owner thread, false otherwise.
+         */
+        bool IsOwnerThread() const
+        {
+            return std::this_thread::get_id() == ownerThread;
+        }
+
+        /**
+         * @brief Posts a command to be executed by the owner thread.
+         *
+         * If called from the owner thread, the command is executed immediately,
+         * so that waiting on the returned future from this thread can never deadlock.
+         * If the queue is destroyed before the command was executed, the future holds a std::future_error.
+         *
+         * @tparam _Fn Callable without parameter.
+         * @param func The command to execute.
+         * @return A future holding the result of the command.
+         */
+        template <typename _Fn>
+        auto Post(_Fn&& func) -> std::future<std::invoke_result_t<std::decay_t<_Fn>>>
+        {
+            using Result = std::invoke_result_t<std::decay_t<_Fn>>;
+
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<_Fn>(func));
+            auto future = task->get_future();
+
+            if (IsOwnerThread())
+            {
+                (*task)();
+                return future;
+            }
+
+            std::scoped_lock lock(mutex);
+            commands.emplace_back([task]() { (*task)(); });
+
+            return future;
+        }
+
+        /**
+         * @brief Queues a command to be executed by the next Execute(), even when called from the owner thread.
+         * @param command The command to execute.
+         */
+        void Defer(std::function<void()> command)
+        {
+            std::scoped_lock lock(mutex);
+            commands.push_back(std::move(command));
+        }
+
+        /**
+         * @brief Executes the pending commands on the calling thread within the given budget.
+         *        At least one command is executed per call if any is pending.
+         * @param budget The time budget in seconds.
+         * @return The number of commands executed.
+         */
+        int Execute(double budget)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            int count = 0;
+
+            do
+            {
+                std::function<void()> command;
+
+                {
+                    std::scoped_lock lock(mutex);
+                    if (commands.empty()) break;
+                    command = std::move(commands.front());
+                    commands.pop_front();
+                }
+
+                command();
+                count++;
+            }
+            while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < budget);
+
+            return count;
+        }
+
+        /**
+         * @brief Gets the number of pending commands.
+         * @return The number of commands waiting to be executed.
+         */
+        std::size_t GetPendingCount() const
+        {
+            std::scoped_lock lock(mutex);
+            return commands.size();
+        }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_COMMAND_QUEUE_HPP
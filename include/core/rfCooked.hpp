@@ -0,0 +1,145 @@
+#ifndef RAYFLEX_CORE_COOKED_HPP
+#define RAYFLEX_CORE_COOKED_HPP
+
+#include <raylib.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Cooked assets are produced offline by the 'rayflex_cook' tool and loaded without any decoding.
+ *
+ * A cooked texture (".rftex") contains the raw pixels of all its mipmap levels in a GPU format,
+ * a cooked model (".rfmdl") contains flattened vertex/index buffers with precomputed bounding boxes.
+ * All values are little endian. The loaders accept any memory buffer, typically a view of a core::AssetPack entry.
+ */
+namespace rf { namespace core {
+
+    /**
+     * @brief Header of a cooked texture, followed by the pixel data of all mipmap levels.
+     */
+    struct CookedTextureHeader
+    {
+        static constexpr uint32_t Magic = 0x58544652;   ///< "RFTX" read as a little endian integer.
+        static constexpr uint32_t Version = 1;          ///< Version of the format.
+
+        uint32_t magic;         ///< Must be CookedTextureHeader::Magic.
+        uint32_t version;       ///< Must be CookedTextureHeader::Version.
+        int32_t width;          ///< Width of the first level.
+        int32_t height;         ///< Height of the first level.
+        int32_t mipmaps;        ///< Number of levels.
+        int32_t format;         ///< Pixel format (PixelFormat).
+        uint64_t dataSize;      ///< Size of the pixel data of all levels.
+    };
+
+    /**
+     * @brief Header of a cooked model, followed by CookedModelHeader::meshCount cooked meshes.
+     */
+    struct CookedModelHeader
+    {
+        static constexpr uint32_t Magic = 0x444D4652;   ///< "RFMD" read as a little endian integer.
+        static constexpr uint32_t Version = 1;          ///< Version of the format.
+
+        uint32_t magic;         ///< Must be CookedModelHeader::Magic.
+        uint32_t version;       ///< Must be CookedModelHeader::Version.
+        uint32_t meshCount;     ///< Number of meshes.
+        uint32_t reserved;      ///< Unused, zero.
+        BoundingBox bounds;     ///< Bounding box of all the meshes.
+    };
+
+    /**
+     * @brief Header of a cooked mesh, followed by its attribute arrays each padded to 4 bytes,
+     *        in this order: vertices, texcoords, texcoords2, normals, tangents, colors, indices.
+     */
+    struct CookedMeshHeader
+    {
+        /**
+         * @brief Flags of the attribute arrays present in the mesh.
+         */
+        enum Attribute : uint32_t
+        {
+            Texcoords = 1 << 0,     ///< 2 floats per vertex.
+            Texcoords2 = 1 << 1,    ///< 2 floats per vertex.
+            Normals = 1 << 2,       ///< 3 floats per vertex.
+            Tangents = 1 << 3,      ///< 4 floats per vertex.
+            Colors = 1 << 4,        ///< 4 bytes per vertex.
+            Indices = 1 << 5        ///< 3 unsigned shorts per triangle.
+        };
+
+        int32_t vertexCount;    ///< Number of vertices, positions are always present (3 floats per vertex).
+        int32_t triangleCount;  ///< Number of triangles.
+        uint32_t attributes;    ///< Combination of Attribute flags.
+        uint32_t reserved;      ///< Unused, zero.
+        BoundingBox bounds;     ///< Bounding box of the mesh.
+    };
+
+    /**
+     * @brief Serializes an image and its mipmaps as a cooked texture.
+     * @param image The image to cook, in any uncompressed or GPU compressed format.
+     * @return The cooked data, empty if the image has no data.
+     */
+    std::vector<unsigned char> CookImage(const ::Image& image);
+
+    /**
+     * @brief Serializes the meshes of a model as a cooked model, materials are not included.
+     * @param model The model to cook, its meshes must have their CPU data.
+     * @return The cooked data.
+     */
+    std::vector<unsigned char> CookModel(const ::Model& model);
+
+    /**
+     * @brief Checks if a buffer contains a cooked texture.
+     * @param data The buffer.
+     * @param size The size of the buffer.
+     * @return True if the buffer starts with a valid cooked texture header.
+     */
+    bool IsCookedTexture(const unsigned char* data, std::size_t size);
+
+    /**
+     * @brief Checks if a buffer contains a cooked model.
+     * @param data The buffer.
+     * @param size The size of the buffer.
+     * @return True if the buffer starts with a valid cooked model header.
+     */
+    bool IsCookedModel(const unsigned char* data, std::size_t size);
+
+    /**
+     * @brief Loads a cooked texture into an image (a single copy of the pixels). Thread-safe.
+     * @param data The cooked data.
+     * @param size The size of the cooked data.
+     * @return The image, with null data if the buffer is invalid.
+     */
+    ::Image LoadCookedImage(const unsigned char* data, std::size_t size);
+
+    /**
+     * @brief Uploads a cooked texture directly from the buffer to the GPU, without intermediate copy.
+     *        Must be called from the thread owning the GL context.
+     * @param data The cooked data.
+     * @param size The size of the cooked data.
+     * @return The texture, with id zero if the buffer is invalid.
+     */
+    ::Texture LoadCookedTexture(const unsigned char* data, std::size_t size);
+
+    /**
+     * @brief Loads a cooked model with a default material.
+     *
+     * Without upload, only the CPU buffers are filled (thread-safe) and the meshes must be uploaded later
+     * from the thread owning the GL context with UploadMesh() before drawing the model.
+     *
+     * @param data The cooked data.
+     * @param size The size of the cooked data.
+     * @param upload Uploads the meshes to the GPU, in which case the GL context is required.
+     * @return The model, with no mesh if the buffer is invalid.
+     */
+    ::Model LoadCookedModel(const unsigned char* data, std::size_t size, bool upload = true);
+
+    /**
+     * @brief Gets the precomputed bounding box of a cooked model without loading it.
+     * @param data The cooked data.
+     * @param size The size of the cooked data.
+     * @return The bounding box, empty if the buffer is invalid.
+     */
+    ::BoundingBox GetCookedModelBounds(const unsigned char* data, std::size_t size);
+
+}}
+
+#endif //RAYFLEX_CORE_COOKED_HPP
@@ -0,0 +1,198 @@
+#ifndef RAYFLEX_CORE_FRAME_ARENA_HPP
+#define RAYFLEX_CORE_FRAME_ARENA_HPP
+
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The FrameArena class is a linear (bump) allocator for the temporary memory of a frame.
+     *
+     * An allocation only moves an atomic offset forward, so it is lock-free and can be done from the main thread
+     * and from the jobs of the frame. Nothing is freed individually: core::App calls NewFrame() at the start
+     * of each frame, which recycles the memory of the frame before the previous one (double-buffering),
+     * so a temporary stays valid during the frame it was allocated in and the next one.
+     *
+     * When a frame needs more than the capacity, the excess is allocated on the heap (behind a mutex)
+     * and the capacity grows to fit it the next time the buffer is reset.
+     *
+     * Must not be used from threads living across frames (e.g. loading tasks), nor for data kept across
+     * frames such as a core::RenderBuffer, whose back buffer still holds the data of two frames ago.
+     */
+    class FrameArena
+    {
+      private:
+        /**
+         * @brief Memory of one frame.
+         */
+        struct Buffer
+        {
+            std::unique_ptr<char[]> data;           ///< Memory allocated from.
+            std::size_t capacity = 0;               ///< Size of 'data' in bytes.
+            std::atomic<std::size_t> offset{0};     ///< Bytes allocated from 'data', up to the capacity.        
+            std::atomic<std::size_t> overflow{0};   ///< Bytes allocated on the heap once 'data' is full.
+            std::vector<void*> overflowBlocks;      ///< Heap allocations to free at the reset.
+        };
+
+      private:
+        Buffer buffers[2];                          ///< Buffers of the current and previous frames.
+        uint32_t current = 0;                       ///< Index of the buffer of the current frame.
+        std::size_t highWaterMark = 0;              ///< Largest number of bytes used by a frame.
+        std::mutex overflowMutex;                   ///< Protects the overflow blocks.
+
+      private:
+        void* AllocateOverflow(Buffer& buffer, std::size_t size, std::size_t alignment);
+        static std::size_t GetUsed(const Buffer& buffer);
+
+      public:
+        /**
+         * @brief Constructs a FrameArena.
+         * @param capacity Initial capacity of each of the two buffers in bytes.
+         */
+        explicit FrameArena(std::size_t capacity = 1 << 20);
+
+        /**
+         * @brief Destructor for the FrameArena class, frees all the memory.
+         */
+        ~FrameArena();
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /**
+         * @brief Allocates memory valid until the end of the next frame.
+         * @param size The size in bytes.
+         * @param alignment The alignment, a power of two.
+         * @return A pointer to the memory, never null.
+         */
+        void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+        {
+            Buffer &buffer = buffers[current];
+            const uintptr_t base = reinterpret_cast<uintptr_t>(buffer.data.get());
+
+            std::size_t offset = buffer.offset.load(std::memory_order_relaxed);
+            std::size_t aligned, end;
+
+            do
+            {
+                aligned = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+                end = aligned + size;
+            }
+            while (end <= buffer.capacity && !buffer.offset.compare_exchange_weak(offset, end, std::memory_order_relaxed));
+
+            if (end > buffer.capacity) return AllocateOverflow(buffer, size, alignment);
+            return buffer.data.get() + aligned;
+        }
+
+        /**
+         * @brief Constructs an object in memory valid until the end of the next frame.
+         *        Its destructor is never called, hence it must be trivially destructible.
+         * @tparam T The type of the object.
+         * @param args The arguments of the constructor.
+         * @return A pointer to the object.
+         */
+        template <typename T, typename... Args>
+        T* New(Args&&... args)
+        {
+            static_assert(std::is_trivially_destructible<T>::value, "FrameArena::New() never calls the destructors");
+            return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Starts a new frame, reusing the memory of the frame before the previous one.
+         *        Called by core::App, no allocation may be running.
+         */
+        void NewFrame();
+
+        /**
+         * @brief Gets the number of bytes allocated during the current frame.
+         * @return The number of bytes, including the padding and the heap overflow.
+         */
+        std::size_t GetUsed() const
+        {
+            return GetUsed(buffers[current]);
+        }
+
+        /**
+         * @brief Gets the capacity of the buffer of the current frame.
+         * @return The capacity in bytes.
+         */
+        std::size_t GetCapacity() const
+        {
+            return buffers[current].capacity;
+        }
+
+        /**
+         * @brief Gets the largest number of bytes allocated during a frame, completed frames only.
+         * @return The high water mark in bytes.
+         */
+        std::size_t GetHighWaterMark() const
+        {
+            return highWaterMark;
+        }
+    };
+
+    /**
+     * @brief The FrameAllocator class adapts a FrameArena to the allocator requirements of the standard containers.
+     *        Deallocations do nothing, the containers must not outlive the next frame
+     *        (in particular, they must not be stored in a core::RenderBuffer).
+     * @tparam T The type of the allocated elements.
+     */
+    template <typename T>
+    class FrameAllocator
+    {
+      public:
+        using value_type = T;
+
+      private:
+        template <typename U> friend class FrameAllocator;
+        FrameArena *arena;          ///< Arena the memory is allocated from.
+
+      public:
+        FrameAllocator(FrameArena& arena) noexcept : arena(&arena) { }
+
+        template <typename U>
+        FrameAllocator(const FrameAllocator<U>& other) noexcept : arena(other.arena) { }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T*, std::size_t) noexcept { }
+
+        template <typename U>
+        bool operator==(const FrameAllocator<U>& other) const noexcept { return arena == other.arena; }
+
+        template <typename U>
+        bool operator!=(const FrameAllocator<U>& other) const noexcept { return arena != other.arena; }
+    };
+
+    template <typename T>
+    using FrameVector = std::vector<T, FrameAllocator<T>>;      ///< Vector of temporaries, e.g. FrameVector<int> v(app->frameArena);
+
+    using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;  ///< String of temporaries.
+
+    /**
+     * @brief Checks if a type is a standard container allocating from a FrameArena (e.g. FrameVector, FrameString).
+     * @tparam T The type to check.
+     */
+    template <typename T, typename = void>
+    struct IsFrameContainer : std::false_type { };
+
+    template <typename T>
+    struct IsFrameContainer<T, std::void_t<typename T::allocator_type>>
+    : std::is_same<typename T::allocator_type, FrameAllocator<typename T::value_type>> { };
+
+}}
+
+#endif //RAYFLEX_CORE_FRAME_ARENA_HPP
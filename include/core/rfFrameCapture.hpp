@@ -0,0 +1,215 @@
+#ifndef RAYFLEX_CORE_FRAME_CAPTURE_HPP
+#define RAYFLEX_CORE_FRAME_CAPTURE_HPP
+
+#include <raylib.h>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief Output format of a core::FrameCapture recording.
+     */
+    enum class CaptureFormat : uint8_t
+    {
+        Png,    ///< One PNG file per frame.
+        Raw,    ///< One file of consecutive RGBA8 frames, rows from top to bottom.
+        Y4M     ///< One YUV4MPEG2 video file (4:2:0, full range), readable by ffmpeg and most players.
+    };
+
+    /**
+     * @brief The FrameCapture class records the content of a render target without stalling the rendering.
+     *
+     * The pixels are read into a ring of pixel buffer objects and mapped a few frames later, once the GPU
+     * has completed the copy, then encoded on a background thread. A recording can be limited to a number
+     * of frames (automated visual tests) or continuous until Stop() (video).
+     *
+     * The asynchronous readback requires OpenGL 3.3, with other graphics APIs the pixels are read synchronously
+     * and only the encoding is done in the background.
+     *
+     * All the methods must be called from the thread owning the GL context, and the FrameCapture
+     * must be destroyed before the window is closed to release its GL resources.
+     */
+    class FrameCapture
+    {
+      private:
+        /**
+         * @brief Destination of a recording, closed when its last frame has been encoded.
+         */
+        struct Output
+        {
+            std::string path;               ///< Path of the file, or pattern of the files for PNG.
+            CaptureFormat format;           ///< Format of the files.
+            uint32_t fps;                   ///< Frame rate written in the Y4M header.
+            std::FILE *file = nullptr;      ///< File of the Raw and Y4M formats.
+            bool numbered = true;           ///< Flag indicating whether the index is added to the PNG file names.
+            bool headerWritten = false;     ///< Flag indicating whether the Y4M header has been written.
+
+            ~Output() { if (file) std::fclose(file); }
+        };
+
+        /**
+         * @brief Frame read back and waiting to be encoded.
+         */
+        struct PendingFrame
+        {
+            std::shared_ptr<Output> output; ///< Recording the frame belongs to.
+            std::vector<uint8_t> pixels;    ///< RGBA8 pixels, rows from bottom to top as read from OpenGL.
+            int width, height;              ///< Size of the frame.
+            uint32_t index;                 ///< Index of the frame in its recording.
+        };
+
+        /**
+         * @brief Pixel buffer object of the readback ring.
+         */
+        struct Slot
+        {
+            uint32_t buffer = 0;            ///< Pixel buffer object.
+            std::size_t capacity = 0;       ///< Size of the storage of the buffer.
+            void *fence = nullptr;          ///< Sync object signaled once the copy is complete.
+            std::shared_ptr<Output> output; ///< Recording of the frame being copied, null if the slot is free.
+            int width = 0, height = 0;      ///< Size of the frame being copied.
+            uint32_t index = 0;             ///< Index of the frame in its recording.
+        };
+
+      private:
+        std::vector<Slot> ring;                     ///< Readback ring, slots are used and completed in order.
+        uint32_t ringHead = 0;                      ///< Next slot to use.
+        uint32_t ringTail = 0;                      ///< Oldest slot in use.
+        uint32_t ringUsed = 0;                      ///< Number of slots in use.
+
+      private:
+        std::shared_ptr<Output> output;             ///< Current recording, null if not recording.
+        uint32_t frameLimit = 0;                    ///< Number of frames to record, zero for no limit.
+        uint32_t frameCount = 0;                    ///< Number of frames captured by the current recording.
+        int frameWidth = 0, frameHeight = 0;        ///< Size of the frames of the current recording.
+
+      private:
+        std::deque<PendingFrame> pendingFrames;     ///< Frames waiting for the encoder, in order.
+        std::vector<std::vector<uint8_t>> buffers;  ///< Pixel buffers of the encoded frames, reused by the next ones.
+        std::thread encoder;                        ///< Encoder thread, started by the first recording.
+        std::mutex encodeMutex;                     ///< Protects the pending frames, the buffers and the encoder state.
+        std::condition_variable encodeCondition;    ///< Signals new frames to the encoder and completions to the main thread.
+        uint32_t maxPendingFrames = 8;              ///< Number of frames waiting for the encoder before back-pressure.
+        bool dropFrames = false;                    ///< Flag indicating whether frames are dropped instead of waiting for the encoder.
+        bool encoding = false;                      ///< Flag indicating whether the encoder is encoding a frame.
+        bool stopEncoder = false;                   ///< Flag asking the encoder thread to exit once idle.
+        std::atomic<uint32_t> droppedCount{0};      ///< Number of frames dropped since the construction.
+
+      private:
+        void ReadPixels(const ::RenderTexture& target);
+        bool CompleteSlot(bool wait);
+        std::vector<uint8_t> AcquireBuffer(std::size_t size);
+        void QueueFrame(PendingFrame frame);
+        void EncoderLoop();
+        static bool Encode(PendingFrame& frame, std::vector<uint8_t>& planes);
+
+      public:
+        /**
+         * @brief Constructs a FrameCapture, the GL resources are created at the first capture.
+         * @param ringSize Number of frames in flight between the copy and the encoding (default is 3).
+         */
+        explicit FrameCapture(uint32_t ringSize = 3);
+
+        /**
+         * @brief Destructor, stops the recording and waits for the pending frames to be encoded.
+         */
+        ~FrameCapture();
+
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        /**
+         * @brief Starts a recording, stopping the current one if any.
+         * @param path The file to write. For PNG, a printf pattern receiving the frame index (e.g. "frame_%04u.png"),
+         *             without pattern the index is added before the extension unless a single frame is recorded.
+         * @param format The format of the output.
+         * @param frames The number of frames to record, zero to record until Stop().
+         * @param fps The frame rate written in the Y4M header (default is 60).
+         * @return True if the recording has started, false if the output file could not be created.
+         */
+        bool Start(const std::string& path, CaptureFormat format, uint32_t frames = 0, uint32_t fps = 60);
+
+        /**
+         * @brief Stops the recording. The frames in flight are read back, their encoding continues in the background.
+         */
+        void Stop();
+
+        /**
+         * @brief Captures the content of a target if recording, and hands the completed copies to the encoder.
+         *        core::App calls it once per frame with its main renderer, after the state has been drawn.
+         * @param target The render target to capture, its size must not change during a recording.
+         */
+        void Capture(const ::RenderTexture& target);
+
+        /**
+         * @brief Blocks until all the captured frames have been encoded.
+         */
+        void Flush();
+
+        /**
+         * @brief Checks if a recording is in progress.
+         * @return True if recording, false otherwise.
+         */
+        bool IsRecording() const
+        {
+            return output != nullptr;
+        }
+
+        /**
+         * @brief Checks if frames are in flight or waiting to be encoded.
+         * @return True if the encoding is not finished, false otherwise.
+         */
+        bool IsEncoding();
+
+        /**
+         * @brief Gets the number of frames captured by the current or last recording.
+         * @return The number of frames.
+         */
+        uint32_t GetFrameCount() const
+        {
+            return frameCount;
+        }
+
+        /**
+         * @brief Gets the number of frames dropped because the encoder was behind, see SetDropFrames().
+         * @return The number of frames dropped since the construction.
+         */
+        uint32_t GetDroppedCount() const
+        {
+            return droppedCount.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Sets the number of frames that can wait for the encoder before the back-pressure applies.
+         * @param frames The number of frames (default is 8), at least one.
+         */
+        void SetMaxPendingFrames(uint32_t frames)
+        {
+            std::scoped_lock lock(encodeMutex);
+            maxPendingFrames = frames > 0 ? frames : 1;
+        }
+
+        /**
+         * @brief Sets what happens when the encoder cannot keep up with the captures.
+         * @param enabled True to drop the frames (gameplay recording), false to wait for the encoder,
+         *                which slows down the frame rate but keeps every frame (default, visual tests).
+         */
+        void SetDropFrames(bool enabled)
+        {
+            std::scoped_lock lock(encodeMutex);
+            dropFrames = enabled;
+        }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_FRAME_CAPTURE_HPP
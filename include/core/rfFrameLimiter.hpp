@@ -0,0 +1,196 @@
+#ifndef RAYFLEX_CORE_FRAME_LIMITER_HPP
+#define RAYFLEX_CORE_FRAME_LIMITER_HPP
+
+#include <cstdint>
+#include <chrono>
+#include <array>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The FrameTimeHistogram class accumulates frame times into fixed width buckets.
+     *        All times are in milliseconds.
+     */
+    class FrameTimeHistogram
+    {
+      public:
+        static constexpr float BucketWidth = 0.5f;          ///< Width of a bucket in milliseconds.
+        static constexpr uint32_t BucketCount = 100;        ///< Number of buckets, the last one also counts the longer frames.
+
+      private:
+        std::array<uint32_t, BucketCount> buckets{};        ///< Number of frames per bucket.
+        uint64_t count = 0;                                 ///< Total number of frames.
+        double sum = 0.0;                                   ///< Sum of the frame times.
+        float min = 0.0f;                                   ///< Shortest frame time.
+        float max = 0.0f;                                   ///< Longest frame time.
+
+      public:
+        /**
+         * @brief Adds a frame time to the histogram.
+         * @param ms The frame time in milliseconds.
+         */
+        void Add(float ms);
+
+        /**
+         * @brief Clears the histogram.
+         */
+        void Reset();
+
+        /**
+         * @brief Estimates a percentile of the frame times from the buckets.
+         * @param p The percentile, from 0 to 1 (e.g. 0.99).
+         * @return The upper bound of the bucket containing the percentile, zero if empty.
+         */
+        float GetPercentile(float p) const;
+
+        /**
+         * @brief Gets the number of frames per bucket, bucket 'i' counts the frames from i*BucketWidth to (i+1)*BucketWidth.
+         * @return The buckets.
+         */
+        const std::array<uint32_t, BucketCount>& GetBuckets() const
+        {
+            return buckets;
+        }
+
+        /**
+         * @brief Gets the number of frames added since the last reset.
+         * @return The number of frames.
+         */
+        uint64_t GetCount() const
+        {
+            return count;
+        }
+
+        /**
+         * @brief Gets the average frame time.
+         * @return The mean in milliseconds, zero if empty.
+         */
+        float GetMean() const
+        {
+            return count ? static_cast<float>(sum / count) : 0.0f;
+        }
+
+        /**
+         * @brief Gets the shortest frame time.
+         * @return The minimum in milliseconds, zero if empty.
+         */
+        float GetMin() const
+        {
+            return min;
+        }
+
+        /**
+         * @brief Gets the longest frame time.
+         * @return The maximum in milliseconds, zero if empty.
+         */
+        float GetMax() const
+        {
+            return max;
+        }
+    };
+
+    /**
+     * @brief The FrameLimiter class paces the frames to a target rate.
+     *
+     * The remaining time of a frame is first slept in short slices as long as it exceeds the estimated
+     * inaccuracy of the OS sleep (learned at runtime), then the last fraction is spent spinning up to the deadline.
+     * This gives the precision of a busy wait for the cost of a fraction of a millisecond of CPU per frame.
+     *
+     * When VSync awareness is enabled and the VSync is active on a monitor whose refresh rate is not above
+     * the target rate, the swap already paces the frames and the limiter only measures them.
+     */
+    class FrameLimiter
+    {
+      private:
+        using Clock = std::chrono::steady_clock;
+
+      private:
+        FrameTimeHistogram histogram;       ///< Durations of the frames.
+        Clock::time_point deadline;         ///< End of the current frame.
+        Clock::time_point lastFrame;        ///< End of the previous frame.
+        Clock::duration period{};           ///< Duration of a frame, zero when unlimited.
+        uint64_t missedDeadlines = 0;       ///< Number of frames that ended after their deadline.
+        uint32_t targetFPS = 0;             ///< Target frame rate, zero when unlimited.
+        bool vsyncAware = true;             ///< Flag indicating whether the pacing is left to an active VSync.
+        bool started = false;               ///< Flag indicating whether the deadline has been initialized.
+
+      private:
+        double sleepMean = 0.001;           ///< Mean duration of a 1ms sleep in seconds.
+        double sleepM2 = 0.0;               ///< Sum of the squared deviations of the sleep durations.
+        double sleepEstimate = 0.002;       ///< Duration under which the remaining time is spent spinning.
+        uint32_t sleepSamples = 1;          ///< Number of sleep durations measured.
+
+      private:
+        bool IsPacedByVSync() const;
+        void SleepUntil(Clock::time_point time);
+
+      public:
+        /**
+         * @brief Sets the target frame rate.
+         * @param fps The number of frames per second, zero to disable the limitation.
+         */
+        void SetTargetFPS(uint32_t fps);
+
+        /**
+         * @brief Gets the target frame rate.
+         * @return The number of frames per second, zero when unlimited.
+         */
+        uint32_t GetTargetFPS() const
+        {
+            return targetFPS;
+        }
+
+        /**
+         * @brief Enables or disables the VSync awareness (enabled by default).
+         * @param enabled True to let an active VSync pace the frames instead of the limiter.
+         */
+        void SetVSyncAware(bool enabled)
+        {
+            vsyncAware = enabled;
+        }
+
+        /**
+         * @brief Waits until the end of the current frame, to call once per frame after the presentation.
+         *        A frame ending after its deadline is counted as missed and the next deadline restarts from now.
+         */
+        void Wait();
+
+        /**
+         * @brief Restarts the pacing from now, e.g. after a long blocking operation, without clearing the statistics.
+         */
+        void Restart()
+        {
+            started = false;
+        }
+
+        /**
+         * @brief Clears the frame time histogram and the missed deadlines counter.
+         */
+        void ResetStats()
+        {
+            histogram.Reset();
+            missedDeadlines = 0;
+        }
+
+        /**
+         * @brief Gets the histogram of the frame durations, from the end of a frame to the end of the next one.
+         * @return The histogram.
+         */
+        const FrameTimeHistogram& GetHistogram() const
+        {
+            return histogram;
+        }
+
+        /**
+         * @brief Gets the number of frames that ended after their deadline.
+         * @return The number of missed deadlines.
+         */
+        uint64_t GetMissedDeadlines() const
+        {
+            return missedDeadlines;
+        }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_FRAME_LIMITER_HPP
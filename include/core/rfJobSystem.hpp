@@ -0,0 +1,210 @@
+#ifndef RAYFLEX_CORE_JOB_SYSTEM_HPP
+#define RAYFLEX_CORE_JOB_SYSTEM_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The JobCounter class tracks the completion of a group of jobs.
+     *
+     * The counter is incremented when a job is submitted with it and decremented when the job is done.
+     * It can be waited on with JobSystem::Wait() or JobSystem::Block() and used as a dependency of other jobs.
+     * A counter must not be destroyed before JobSystem::Wait() or JobSystem::Block() returned for it.
+     */
+    class JobCounter
+    {
+      private:
+        friend class JobSystem;
+
+        std::atomic<int> value{0};                          ///< Number of jobs still running or pending.
+        mutable std::mutex mutex;                           ///< Protects the value release and the list of continuations.
+        mutable std::condition_variable condition;          ///< Signaled when the value reaches zero, for JobSystem::Block().
+        std::vector<std::function<void()>> continuations;   ///< Jobs waiting for this counter to reach zero.
+
+      public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        /**
+         * @brief Checks if all the jobs associated with this counter are done.
+         * @return True if done, false otherwise.
+         */
+        bool IsDone() const
+        {
+            return value.load(std::memory_order_acquire) == 0;
+        }
+
+        /**
+         * @brief Gets the number of jobs still running or pending.
+         * @return The number of jobs.
+         */
+        int GetValue() const
+        {
+            return value.load(std::memory_order_acquire);
+        }
+    };
+
+    /**
+     * @brief The JobSystem class runs jobs on a pool of worker threads using work stealing.
+     *
+     * Each worker owns a deque into which the jobs it submits are pushed, it pops its own jobs from the back
+     * and steals from the front of the other workers' deques when it runs out of work.
+     * Jobs submitted from a thread that is not a worker go into a shared queue.
+     * A thread waiting on a counter with Wait() executes pending jobs instead of blocking.
+     */
+    class JobSystem
+    {
+      public:
+        using Job = std::function<void()>;
+
+      private:
+        /**
+         * @brief Deque of jobs owned by a worker.
+         */
+        struct WorkerQueue
+        {
+            std::mutex mutex;           ///< Protects the deque.
+            std::deque<Job> jobs;       ///< Jobs pushed by the owner thread.
+        };
+
+      private:
+        std::vector<std::unique_ptr<WorkerQueue>> queues;   ///< One queue per worker.
+        std::vector<std::thread> workers;                   ///< Worker threads.
+        WorkerQueue sharedQueue;                            ///< Queue for jobs submitted from outside the workers.
+
+        std::mutex sleepMutex;                              ///< Mutex used by idle workers to sleep.
+        std::condition_variable sleepCondition;             ///< Condition variable waking up idle workers.
+        std::atomic<int> pendingJobs{0};                    ///< Number of jobs queued and not yet taken.
+        std::atomic<bool> running{false};                   ///< Flag indicating whether the workers should keep running.
+
+      private:
+        void WorkerLoop(uint32_t index);
+        void Push(Job&& job);
+        bool Pop(Job& job);
+        void Release(JobCounter& counter);
+
+      public:
+        /**
+         * @brief Constructs a JobSystem and starts its workers.
+         * @param numWorkers The number of worker threads, 0 to use the number of hardware threads minus one.
+         *
+         * On PLATFORM_WEB no worker is started and jobs are executed immediately by the submitting thread.
+         */
+        JobSystem(uint32_t numWorkers = 0);
+
+        /**
+         * @brief Stops the workers after they have completed all the queued jobs.
+         */
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Stops and joins the workers after they have completed all the queued jobs.
+         *        Jobs submitted afterwards are executed immediately by the submitting thread.
+         */
+        void Shutdown();
+
+        /**
+         * @brief Gets the number of worker threads.
+         * @return The number of workers.
+         */
+        uint32_t GetWorkerCount() const
+        {
+            return static_cast<uint32_t>(workers.size());
+        }
+
+        /**
+         * @brief Gets the index of the calling worker thread.
+         * @return The worker index, or -1 if the calling thread is not a worker of a JobSystem.
+         */
+        static int GetWorkerIndex();
+
+        /**
+         * @brief Submits a job.
+         * @param job The job to execute.
+         * @param counter Optional counter incremented now and decremented once the job is done.
+         * @param dependency Optional counter which must reach zero before the job is queued.
+         */
+        void Run(Job job, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+        /**
+         * @brief Waits until the given counter reaches zero, executing pending jobs meanwhile.
+         * @param counter The counter to wait on.
+         */
+        void Wait(const JobCounter& counter);
+
+        /**
+         * @brief Waits until the given counter reaches zero, sleeping instead of executing pending jobs.
+         *        To be used by a thread which must resume as soon as its jobs are done (e.g. the main thread
+         *        waiting for the pipelined update), as an unrelated pending job may take arbitrarily long.
+         * @param counter The counter to wait on.
+         */
+        void Block(const JobCounter& counter);
+
+        /**
+         * @brief Executes one pending job on the calling thread, if any.
+         * @return True if a job was executed, false if there was nothing to do.
+         */
+        bool TryRunPending();
+
+        /**
+         * @brief Splits the range [0, count) into chunks and submits one job per chunk.
+         * @tparam _Fn Callable with the signature void(uint32_t begin, uint32_t end).
+         * @param count The number of elements to process.
+         * @param grainSize The minimum number of elements per job (0 to split evenly across the workers).
+         * @param func The function executed for each chunk.
+         * @param counter The counter tracking the completion of the chunks.
+         */
+        template <typename _Fn>
+        void ParallelFor(uint32_t count, uint32_t grainSize, _Fn&& func, JobCounter& counter)
+        {
+            if (count == 0) return;
+
+            if (grainSize == 0)
+            {
+                const uint32_t numChunks = 4 * (GetWorkerCount() + 1);
+                grainSize = std::max(1u, (count + numChunks - 1) / numChunks);
+            }
+
+            // The function is shared by all the chunks and must outlive the call
+            auto shared = std::make_shared<std::decay_t<_Fn>>(std::forward<_Fn>(func));
+
+            for (uint32_t begin = 0; begin < count; begin += grainSize)
+            {
+                const uint32_t end = std::min(begin + grainSize, count);
+                Run([shared, begin, end]() { (*shared)(begin, end); }, &counter);
+            }
+        }
+
+        /**
+         * @brief Splits the range [0, count) into chunks, processes them in parallel and waits for their completion.
+         * @tparam _Fn Callable with the signature void(uint32_t begin, uint32_t end).
+         * @param count The number of elements to process.
+         * @param func The function executed for each chunk.
+         * @param grainSize The minimum number of elements per job (0 to split evenly across the workers).
+         */
+        template <typename _Fn>
+        void ParallelFor(uint32_t count, _Fn&& func, uint32_t grainSize = 0)
+        {
+            JobCounter counter;
+            ParallelFor(count, grainSize, std::forward<_Fn>(func), counter);
+            Wait(counter);
+        }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_JOB_SYSTEM_HPP
@@ -0,0 +1,207 @@
+#ifndef RAYFLEX_CORE_MEMORY_TRACKER_HPP
+#define RAYFLEX_CORE_MEMORY_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <array>
+#include <new>
+
+#ifndef RAYFLEX_MEMORY_TRACKING
+#   define RAYFLEX_MEMORY_TRACKING 0
+#endif
+
+namespace rf { namespace core {
+
+    /**
+     * @brief Subsystems the tracked memory is accounted to.
+     */
+    enum class MemoryTag : uint8_t
+    {
+        General,        ///< Everything not tagged otherwise.
+        Assets,         ///< Assets of core::AssetManager (estimated footprint, see core::AssetTraits).
+        Sprites,        ///< Animations and instances of the sprites.
+        Particles,      ///< Particle buffers.
+        Physics,        ///< Physics objects.
+        Network,        ///< Message queues of the connections.
+        Count           ///< Number of tags.
+    };
+
+    /**
+     * @brief Memory statistics of a tag, or of all the tags together.
+     */
+    struct MemoryStats
+    {
+        std::size_t bytes = 0;              ///< Bytes currently allocated.
+        std::size_t peakBytes = 0;          ///< Largest number of bytes allocated at once.
+        std::size_t allocations = 0;        ///< Allocations not freed yet.
+        std::size_t totalAllocations = 0;   ///< Allocations since the start.
+        std::size_t frameAllocations = 0;   ///< Allocations during the last completed frame.
+    };
+
+    /**
+     * @brief The MemoryReport struct is a snapshot of the statistics of all the tags.
+     */
+    struct MemoryReport
+    {
+        std::array<MemoryStats, static_cast<std::size_t>(MemoryTag::Count)> tags{};   ///< Statistics per tag.
+        MemoryStats total;                  ///< Sum of the tags, the peak is the largest total seen by a frame boundary.
+
+        /**
+         * @brief Serializes the report as JSON.
+         * @return The JSON document.
+         */
+        std::string ToJSON() const;
+
+        /**
+         * @brief Writes the report to a JSON file.
+         * @param fileName The path of the file to write.
+         * @return True if the file was written, false otherwise.
+         */
+        bool Save(const std::string& fileName) const;
+    };
+
+    /**
+     * @brief The MemoryTracker class counts the allocations of the instrumented subsystems, per tag.
+     *
+     * The tracking is opt-in at compile time with the RAYFLEX_MEMORY_TRACKING option. When disabled, the recording
+     * functions are empty, TrackedAllocator is std::allocator and TrackedObject is an empty base, so there is no cost.
+     * Counters are lock-free and can be updated from any thread. core::App marks the frame boundaries.
+     */
+    class MemoryTracker
+    {
+      private:
+        static void Record(MemoryTag tag, std::size_t bytes);
+        static void Release(MemoryTag tag, std::size_t bytes);
+
+      public:
+        /**
+         * @brief Checks if the tracking has been compiled in.
+         * @return True if the allocations are counted, false otherwise.
+         */
+        static constexpr bool IsEnabled()
+        {
+            return RAYFLEX_MEMORY_TRACKING != 0;
+        }
+
+        /**
+         * @brief Counts an allocation.
+         * @param tag The subsystem the memory belongs to.
+         * @param bytes The size of the allocation.
+         */
+        static void Allocate(MemoryTag tag, std::size_t bytes)
+        {
+            if constexpr (IsEnabled()) Record(tag, bytes);
+        }
+
+        /**
+         * @brief Counts the release of an allocation.
+         * @param tag The subsystem the memory belonged to.
+         * @param bytes The size given to Allocate().
+         */
+        static void Free(MemoryTag tag, std::size_t bytes)
+        {
+            if constexpr (IsEnabled()) Release(tag, bytes);
+        }
+
+        /**
+         * @brief Closes the allocation counts of the current frame, called by core::App.
+         */
+        static void NewFrame();
+
+        /**
+         * @brief Gets the statistics of a tag.
+         * @param tag The tag.
+         * @return The statistics, all zero if the tracking is disabled.
+         */
+        static MemoryStats GetStats(MemoryTag tag);
+
+        /**
+         * @brief Gets the statistics of all the tags.
+         * @return The report.
+         */
+        static MemoryReport GetReport();
+
+        /**
+         * @brief Gets the name of a tag, as used in the JSON report.
+         * @param tag The tag.
+         * @return The name of the tag.
+         */
+        static const char* GetTagName(MemoryTag tag);
+    };
+
+#if RAYFLEX_MEMORY_TRACKING
+
+    /**
+     * @brief The TrackedAllocator class is a std::allocator counting its allocations in the MemoryTracker.
+     * @tparam T The type of the allocated elements.
+     * @tparam Tag The subsystem the memory is accounted to.
+     */
+    template <typename T, MemoryTag Tag>
+    class TrackedAllocator
+    {
+      public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind { using other = TrackedAllocator<U, Tag>; };
+
+      public:
+        TrackedAllocator() noexcept = default;
+
+        template <typename U>
+        TrackedAllocator(const TrackedAllocator<U, Tag>&) noexcept { }
+
+        T* allocate(std::size_t n)
+        {
+            MemoryTracker::Allocate(Tag, n * sizeof(T));
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept
+        {
+            MemoryTracker::Free(Tag, n * sizeof(T));
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template <typename U>
+        bool operator==(const TrackedAllocator<U, Tag>&) const noexcept { return true; }
+
+        template <typename U>
+        bool operator!=(const TrackedAllocator<U, Tag>&) const noexcept { return false; }
+    };
+
+    /**
+     * @brief The TrackedObject struct is a base class counting the heap allocations of the derived objects.
+     * @tparam Tag The subsystem the objects are accounted to.
+     */
+    template <MemoryTag Tag>
+    struct TrackedObject
+    {
+        static void* operator new(std::size_t size)
+        {
+            MemoryTracker::Allocate(Tag, size);
+            return ::operator new(size);
+        }
+
+        static void operator delete(void* ptr, std::size_t size) noexcept
+        {
+            MemoryTracker::Free(Tag, size);
+            ::operator delete(ptr);
+        }
+    };
+
+#else
+
+    template <typename T, MemoryTag Tag>
+    using TrackedAllocator = std::allocator<T>;
+
+    template <MemoryTag Tag>
+    struct TrackedObject { };
+
+#endif
+
+}}
+
+#endif //RAYFLEX_CORE_MEMORY_TRACKER_HPP
@@ -2,9 +2,13 @@
 #define RAYFLEX_CORE_MUSIC_MANAGER_HPP
 
 #include <raylib-cpp.hpp>
+#include <condition_variable>
 #include <unordered_map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
+#include <mutex>
 
 /**
  * @brief A module for managing music in Raylib.
@@ -15,11 +19,18 @@ namespace rf { namespace core {
 
     /**
      * @brief The MusicManager class handles the management of music in Raylib.
+     *
+     * The music streams are refilled on a dedicated thread, started by the first playback, which also detects
+     * the end of the tracks and advances the playlist, so that a long frame never starves the audio buffers.
+     * Near the end of a playlist track, the next one is decoded ahead and kept paused so that it starts without gap.
+     * All the member functions can be called from any thread. On the web, where threads are not available,
+     * Update() must still be called every frame.
      */
     class MusicManager
     {
       private:
-        using Playlist = std::vector<std::pair<const std::string, std::unique_ptr<raylib::Music>>*>;
+        using Entry = std::pair<const std::string, std::unique_ptr<raylib::Music>>;
+        using Playlist = std::vector<Entry*>;
 
       private:
         std::unordered_map<std::string, std::unique_ptr<raylib::Music>> musics;         ///< Map of music objects by their names. 
@@ -29,23 +40,48 @@ namespace rf { namespace core {
         std::pair<const std::string, std::unique_ptr<raylib::Music>> *currentMusic;     ///< Pointer to the current music being played.
         std::pair<const std::string, Playlist> *currentPlaylist;                        ///< Pointer to the current playlist being used.
         int currentMusicIndex;                                                          ///< Index of the current music track in the playlist.
+        Entry *nextMusic;                                                               ///< Playlist track decoded ahead to follow the current one, paused until then.
+        int nextMusicIndex;                                                             ///< Index of the track decoded ahead in the playlist.
 
       private:
         float volume, pitch, pan;                                                       ///< Audio properties: volume, pitch, pan.
         bool looping, randomize;                                                        ///< Flags for looping and randomizing music playback.
         bool onPlaying;                                                                 ///< Flag indicating whether music is currently playing.
 
+      private:
+        mutable std::recursive_mutex mutex;                                             ///< Protects the whole state, shared with the streaming thread.
+        std::condition_variable_any streamCondition;                                    ///< Wakes the streaming thread up early.
+        std::thread streamer;                                                           ///< Streaming thread, started by the first playback.
+        bool stopStreamer;                                                              ///< Flag asking the streaming thread to exit.
+        std::minstd_rand randomEngine;                                                  ///< Random order of the playlist, usable from the streaming thread.
+
       private:
         void PlayCurrentMusic()
         {
-            // Set audio properties and play the music
+            // Set audio properties and play the music, the looping is left to the stream itself so that it has no gap
+            currentMusic->second->SetLooping(looping);
             currentMusic->second->SetVolume(volume);
             currentMusic->second->SetPitch(pitch);
             currentMusic->second->SetPan(pan);
             currentMusic->second->Play();
             onPlaying = true;
+
+            // Fills the new stream without waiting for the next period of the streaming thread
+            StartStreamer();
+            streamCondition.notify_all();
         }
 
+        int RandomIndex(int count)
+        {
+            return std::uniform_int_distribution<int>(0, count - 1)(randomEngine);
+        }
+
+        void StartStreamer();           ///< Starts the streaming thread if not running yet.
+        void StreamLoop();              ///< Loop of the streaming thread.
+        void UpdateStream();            ///< Refills the streams and handles the end of the current track.
+        void PrepareNextMusic();        ///< Decodes ahead the track of the playlist following the current one.
+        void CancelNextMusic();         ///< Stops the track decoded ahead, if any, when the playback changes.
+
       public:
         /**
          * @brief Default constructor for the MusicManager class.
@@ -54,14 +90,26 @@ namespace rf { namespace core {
         : currentMusic(nullptr)
         , currentPlaylist(nullptr)
         , currentMusicIndex(-1)
+        , nextMusic(nullptr)
+        , nextMusicIndex(-1)
         , volume(1.0f)
         , pitch(1.0f)
         , pan(0.5f)
         , looping(false)
         , randomize(false)
         , onPlaying(false)
+        , stopStreamer(false)
+        , randomEngine(std::random_device{}())
         { }
 
+        /**
+         * @brief Destructor for the MusicManager class, stops the streaming thread.
+         */
+        ~MusicManager();
+
+        MusicManager(const MusicManager&) = delete;
+        MusicManager& operator=(const MusicManager&) = delete;
+
         /**
          * @brief Loads a music file from the file system.
          *
@@ -70,6 +118,7 @@ namespace rf { namespace core {
          */
         void Load(const std::string& name, const std::string& filePath)
         {
+            std::scoped_lock lock(mutex);
             musics.emplace(name, std::make_unique<raylib::Music>(filePath));
         }
 
@@ -95,6 +144,7 @@ namespace rf { namespace core {
          */
         void Load(const std::string& name, const std::string& fileType, const uint8_t* data, int dataSize)
         {
+            std::scoped_lock lock(mutex);
             musics.emplace(name, std::make_unique<raylib::Music>(LoadMusicStreamFromMemory(fileType.c_str(), data, dataSize)));
         }
 
@@ -108,6 +158,7 @@ namespace rf { namespace core {
          */
         void Load(const std::string& name, const Music& music)
         {
+            std::scoped_lock lock(mutex);
             musics.emplace(name, std::make_unique<raylib::Music>(music));
         }
 
@@ -123,6 +174,8 @@ namespace rf { namespace core {
         {
             if (list.size() == 0) return false;
 
+            std::scoped_lock lock(mutex);
+
             // Try to insert the new playlist into the playlists map
             auto it = playlists.emplace(name, Playlist{});
             if (!it.second) return false;
@@ -157,6 +210,9 @@ namespace rf { namespace core {
          */
         bool SetPlaylist(const std::string& name = "")
         {
+            std::scoped_lock lock(mutex);
+            CancelNextMusic();
+
             // If no name is provided, unset the current playlist
             if (name.empty())
             {
@@ -181,6 +237,8 @@ namespace rf { namespace core {
          */
         void RandomizePlaylist(bool value)
         {
+            std::scoped_lock lock(mutex);
+            CancelNextMusic();
             randomize = value;
         }
 
@@ -191,9 +249,12 @@ namespace rf { namespace core {
          *
          * @param name The name of the music to retrieve from the playlist.
          * @return An iterator pointing to the music in the playlist if found; otherwise, musics.end().
+         *
+         * @note The playback of a music managed by the MusicManager must not be controlled through this iterator.
          */
         auto Get(const std::string& name)
         {
+            std::scoped_lock lock(mutex);
             return musics.find(name);
         }
 
@@ -204,6 +265,7 @@ namespace rf { namespace core {
          */
         float GetVolume() const
         {
+            std::scoped_lock lock(mutex);
             return volume;
         }
 
@@ -214,6 +276,7 @@ namespace rf { namespace core {
          */
         float GetPitch() const
         {
+            std::scoped_lock lock(mutex);
             return pitch;
         }
 
@@ -224,6 +287,7 @@ namespace rf { namespace core {
          */
         float GetPan() const
         {
+            std::scoped_lock lock(mutex);
             return pan;
         }
 
@@ -234,6 +298,7 @@ namespace rf { namespace core {
          */
         void SetVolume(float value)
         {
+            std::scoped_lock lock(mutex);
             volume = value;
 
             // If there is currently playing music, update its volume
@@ -250,6 +315,7 @@ namespace rf { namespace core {
          */
         void SetPitch(float value)
         {
+            std::scoped_lock lock(mutex);
             pitch = value;
 
             // If there is currently playing music, update its pitch
@@ -266,6 +332,7 @@ namespace rf { namespace core {
          */
         void SetPan(float value)
         {
+            std::scoped_lock lock(mutex);
             pan = value;
 
             // If there is currently playing music, update its pan
@@ -282,7 +349,16 @@ namespace rf { namespace core {
          */
         void SetLooping(bool value)
         {
+            std::scoped_lock lock(mutex);
             looping = value;
+
+            if (currentMusic != nullptr)
+            {
+                currentMusic->second->SetLooping(value);
+            }
+
+            // A looping track is never followed
+            if (looping) CancelNextMusic();
         }
 
         /**
@@ -292,6 +368,7 @@ namespace rf { namespace core {
          */
         bool IsLooping() const
         {
+            std::scoped_lock lock(mutex);
             return looping;
         }
 
@@ -302,6 +379,7 @@ namespace rf { namespace core {
          */
         bool IsPlaying() const
         {
+            std::scoped_lock lock(mutex);
             return currentMusic != nullptr && onPlaying;
         }
 
@@ -317,6 +395,8 @@ namespace rf { namespace core {
          */
         bool Play(const std::string& name = "")
         {
+            std::scoped_lock lock(mutex);
+
             // If music is still playing, we stop it first
             if (currentMusic != nullptr) Stop();
 
@@ -326,7 +406,7 @@ namespace rf { namespace core {
                 if (currentPlaylist == nullptr) return false;
 
                 // Determine the index of the next track based on whether randomization is enabled
-                currentMusicIndex = randomize ? GetRandomValue(0, currentPlaylist->second.size() - 1) : 0;
+                currentMusicIndex = randomize ? RandomIndex(currentPlaylist->second.size()) : 0;
 
                 // Set the current music to the next track in the playlist
                 currentMusic = currentPlaylist->second[currentMusicIndex];
@@ -358,6 +438,8 @@ namespace rf { namespace core {
          */
         bool Pause()
         {
+            std::scoped_lock lock(mutex);
+
             if (currentMusic != nullptr)
             {
                 currentMusic->second->Pause();
@@ -374,6 +456,8 @@ namespace rf { namespace core {
          */
         bool Resume()
         {
+            std::scoped_lock lock(mutex);
+
             if (currentMusic != nullptr)
             {
                 currentMusic->second->Resume();
@@ -390,6 +474,9 @@ namespace rf { namespace core {
          */
         bool Stop()
         {
+            std::scoped_lock lock(mutex);
+            CancelNextMusic();
+
             if (currentMusic != nullptr)
             {
                 currentMusic->second->Stop();
@@ -407,6 +494,8 @@ namespace rf { namespace core {
          */
         bool Rewind()
         {
+            std::scoped_lock lock(mutex);
+
             if (currentMusic != nullptr)
             {
                 // Stop the music and restart it to simulate rewinding
@@ -426,8 +515,12 @@ namespace rf { namespace core {
          */
         bool NextMusic()
         {
+            std::scoped_lock lock(mutex);
+
             if (currentPlaylist != nullptr)
             {
+                CancelNextMusic();
+
                 // If music is currently playing, stop it
                 if (currentMusic != nullptr) currentMusic->second->Stop();
 
@@ -455,8 +548,12 @@ namespace rf { namespace core {
          */
         bool PreviousMusic()
         {
+            std::scoped_lock lock(mutex);
+
             if (currentPlaylist != nullptr)
             {
+                CancelNextMusic();
+
                 // If music is currently playing, stop it
                 if (currentMusic != nullptr) currentMusic->second->Stop();
 
@@ -484,7 +581,10 @@ namespace rf { namespace core {
          */
         bool RandomMusic()
         {
+            std::scoped_lock lock(mutex);
+
             if (currentPlaylist == nullptr || currentPlaylist->second.size() < 2) return false;
+            CancelNextMusic();
 
             // If music is currently playing, stop it
             if (currentMusic != nullptr) currentMusic->second->Stop();
@@ -499,7 +599,7 @@ namespace rf { namespace core {
             int nextIndex = -1;
 
             // Choose a random index for the next track, ensuring it is different from the current index
-            do nextIndex = GetRandomValue(0, currentPlaylist->second.size()-1);
+            do nextIndex = RandomIndex(currentPlaylist->second.size());
             while (nextIndex == currentMusicIndex);
 
             // Set the current music to the randomly chosen track
@@ -520,6 +620,7 @@ namespace rf { namespace core {
          */
         std::string CurrentMusic() const
         {
+            std::scoped_lock lock(mutex);
             return IsPlaying() ? currentMusic->first : "";
         }
 
@@ -530,11 +631,13 @@ namespace rf { namespace core {
          */
         std::string CurrentPlaylist() const
         {
-            return IsPlaying() ? currentPlaylist->first : "";
+            std::scoped_lock lock(mutex);
+            return IsPlaying() && currentPlaylist != nullptr ? currentPlaylist->first : "";
         }
 
         /**
-         * @brief Updates the MusicManager, checking for track completion and handling playback accordingly.
+         * @brief Updates the music streams when they cannot be updated by the streaming thread (web platform),
+         *        does nothing otherwise.
          *
          * If a track is completed and looping is enabled, the track is rewound. If a playlist is active,
          * and randomization is enabled, a random track is played next. Otherwise, the next track in the
@@ -542,29 +645,10 @@ namespace rf { namespace core {
          */
         void Update()
         {
-            if (currentMusic != nullptr)
-            {
-                currentMusic->second->Update();
-
-                // Check if the current track has completed
-                if (currentMusic->second->GetTimePlayed() >= currentMusic->second->GetTimeLength())
-                {
-                    // Handle track completion based on looping, randomization, and playlist settings
-                    if (looping)
-                    {
-                        Rewind();
-                    }
-                    else if (currentPlaylist != nullptr)
-                    {
-                        if (randomize) RandomMusic();
-                        else NextMusic();
-                    }
-                    else
-                    {
-                        Stop();
-                    }
-                }
-            }
+#       ifdef PLATFORM_WEB
+            std::scoped_lock lock(mutex);
+            UpdateStream();
+#       endif
         }
     };
 
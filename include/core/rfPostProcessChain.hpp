@@ -0,0 +1,196 @@
+#ifndef RAYFLEX_CORE_POST_PROCESS_CHAIN_HPP
+#define RAYFLEX_CORE_POST_PROCESS_CHAIN_HPP
+
+#include "./rfRenderTargetPool.hpp"
+
+#include <raylib.h>
+#include <functional>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief Resolution of the output of a post-processing pass, relative to the size of the processed texture.
+     */
+    enum class PostProcessScale : uint8_t
+    {
+        Full = 1,       ///< Same size as the processed texture.
+        Half = 2,       ///< Half of the width and height (e.g. bloom downsampling and blur).
+        Quarter = 4     ///< Quarter of the width and height.
+    };
+
+    /**
+     * @brief The PostProcessChain class applies a sequence of full-screen shader passes to the texture of a core::Renderer.
+     *
+     * Two kinds of passes can be added:
+     *  - Effects (AddEffect()), which only transform the color of a pixel (tonemapping, color grading, vignette...).
+     *    The source defines a function 'vec4 effect(vec4 color, vec2 uv)'. Consecutive effects of the same scale
+     *    are fused into a single shader when the chain is built, so that they cost one full-screen draw together.
+     *  - Passes (AddPass()), complete fragment shaders free to sample their input anywhere (blur, FXAA, CRT...).
+     *
+     * Without '#version' directive, a source is prefixed with a header matching the current OpenGL version, which
+     * declares the inputs 'fragTexCoord' and 'fragColor', the output 'finalColor' and the uniforms 'texture0' (input
+     * of the pass), 'colDiffuse', 'texelSize' (size of a texel of the input) and 'sourceTexture' (texture given to
+     * the chain, e.g. to combine a bloom with the scene). 'texture()' is available on every version.
+     * The names of the uniforms and helper functions of the effects must be unique within the chain.
+     *
+     * The intermediate results alternate between two targets per scale (ping-pong) borrowed from a core::RenderTargetPool
+     * for the duration of Apply(), and the last pass is drawn directly to the current framebuffer (e.g. the backbuffer).
+     *
+     * All the methods must be called from the thread owning the GL context.
+     */
+    class PostProcessChain
+    {
+      public:
+        using UniformSetter = std::function<void(const ::Shader&)>;    ///< Sets the uniforms of a pass, called before each of its draws.
+
+      private:
+        /**
+         * @brief Pass added by the user.
+         */
+        struct Pass
+        {
+            std::string name;               ///< Name of the pass, used in the logs.
+            std::string source;             ///< Source of the effect or of the fragment shader.
+            UniformSetter setUniforms;      ///< Uniforms setter of the pass, if any.
+            PostProcessScale scale;         ///< Resolution of the output.
+            bool effect;                    ///< Whether the pass is a per-pixel effect which can be fused.
+            bool enabled;                   ///< Whether the pass is executed.
+        };
+
+        /**
+         * @brief Full-screen draw of the built chain, one pass or several fused effects.
+         */
+        struct Stage
+        {
+            ::Shader shader;                ///< Shader of the stage.
+            std::vector<uint32_t> passes;   ///< Indices of the passes executed by the stage.
+            PostProcessScale scale;         ///< Resolution of the output.
+            int locTexelSize;               ///< Location of the 'texelSize' uniform.
+            int locSourceTexture;           ///< Location of the 'sourceTexture' uniform.
+        };
+
+      private:
+        std::vector<Pass> passes;           ///< Passes in execution order.
+        std::vector<Stage> stages;          ///< Stages built from the enabled passes.
+        RenderTargetPool ownPool;           ///< Pool of the intermediate targets when Apply() is not given one.
+        bool dirty = true;                  ///< Flag indicating whether the stages must be built again.
+
+      private:
+        static std::string GetHeader();
+        static std::string GetFusedSource(const std::vector<const Pass*>& effects);
+        bool LoadStage(Stage& stage, const std::string& source, const std::string& name);
+
+      public:
+        PostProcessChain() = default;
+
+        /**
+         * @brief Destructor, unloads the shaders of the built chain.
+         */
+        ~PostProcessChain()
+        {
+            Unload();
+        }
+
+        PostProcessChain(const PostProcessChain&) = delete;
+        PostProcessChain& operator=(const PostProcessChain&) = delete;
+
+        /**
+         * @brief Adds a per-pixel effect at the end of the chain.
+         * @param name The name of the effect, used in the logs.
+         * @param source GLSL code defining 'vec4 effect(vec4 color, vec2 uv)', with its uniforms and helpers.
+         * @param scale The resolution of the output (default is PostProcessScale::Full).
+         * @return The index of the pass.
+         */
+        uint32_t AddEffect(const std::string& name, const std::string& source, PostProcessScale scale = PostProcessScale::Full);
+
+        /**
+         * @brief Adds a pass at the end of the chain.
+         * @param name The name of the pass, used in the logs.
+         * @param fragmentSource The source of the fragment shader, sampling its input from 'texture0'.
+         * @param scale The resolution of the output (default is PostProcessScale::Full).
+         * @return The index of the pass.
+         */
+        uint32_t AddPass(const std::string& name, const std::string& fragmentSource, PostProcessScale scale = PostProcessScale::Full);
+
+        /**
+         * @brief Sets the function setting the uniforms of a pass. For a fused effect, the shader given is the fused one.
+         * @param pass The index of the pass.
+         * @param setter The uniforms setter, or nullptr.
+         */
+        void SetUniforms(uint32_t pass, UniformSetter setter);
+
+        /**
+         * @brief Enables or disables a pass, the chain is built again at the next Apply().
+         * @param pass The index of the pass.
+         * @param enabled True to execute the pass, false to skip it.
+         */
+        void SetEnabled(uint32_t pass, bool enabled);
+
+        /**
+         * @brief Checks if a pass is enabled.
+         * @param pass The index of the pass.
+         * @return True if enabled, false otherwise.
+         */
+        bool IsEnabled(uint32_t pass) const
+        {
+            return pass < passes.size() && passes[pass].enabled;
+        }
+
+        /**
+         * @brief Removes all the passes.
+         */
+        void Clear();
+
+        /**
+         * @brief Compiles the shaders of the enabled passes, fusing the consecutive effects of the same scale.
+         *        Called by Apply() when the chain has changed, can be called beforehand to avoid a hitch.
+         * @return True if all the stages were compiled, false otherwise (the failing stages are skipped).
+         */
+        bool Build();
+
+        /**
+         * @brief Unloads the shaders of the built chain, which is built again at the next Apply().
+         */
+        void Unload();
+
+        /**
+         * @brief Draws a texture through the chain to the current framebuffer.
+         * @param texture The texture to process, usually the target of a core::Renderer.
+         * @param source The source rectangle in the texture (negative height for a render texture).
+         * @param dest The destination rectangle of the last pass.
+         * @param tint The tint of the last pass.
+         * @param pool The pool the intermediate targets are borrowed from (default is the pool of the chain).
+         */
+        void Apply(const Texture2D& texture, const Rectangle& source, const Rectangle& dest, Color tint = WHITE, RenderTargetPool* pool = nullptr);
+
+        /**
+         * @brief Checks if the chain has no enabled pass, Apply() is then a plain draw of the texture.
+         * @return True if no pass is enabled, false otherwise.
+         */
+        bool IsEmpty() const;
+
+        /**
+         * @brief Gets the number of passes added, enabled or not.
+         * @return The number of passes.
+         */
+        uint32_t GetPassCount() const
+        {
+            return static_cast<uint32_t>(passes.size());
+        }
+
+        /**
+         * @brief Gets the number of full-screen draws executed by Apply() once the effects are fused.
+         * @return The number of stages of the built chain, zero if not built yet.
+         */
+        uint32_t GetStageCount() const
+        {
+            return static_cast<uint32_t>(stages.size());
+        }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_POST_PROCESS_CHAIN_HPP
@@ -0,0 +1,246 @@
+#ifndef RAYFLEX_CORE_PROFILER_HPP
+#define RAYFLEX_CORE_PROFILER_HPP
+
+#include <unordered_map>
+#include <string_view>
+#include <utility>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include <array>
+#include <mutex>
+
+#define RF_PROFILE_CONCAT_IMPL(a, b) a##b
+#define RF_PROFILE_CONCAT(a, b) RF_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Profiles the enclosing scope under the given name.
+ * @param profiler The core::Profiler instance receiving the event (e.g. app->profiler).
+ * @param name A string literal (or any string with static storage duration) naming the scope.
+ */
+#define RF_PROFILE_SCOPE(profiler, name) \
+    ::rf::core::Profiler::Scope RF_PROFILE_CONCAT(rfProfileScope, __LINE__)((profiler), (name))
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The Profiler class records timestamped scopes from any thread and keeps per-scope frame statistics.
+     *
+     * Each thread writes its events into its own ring buffer without taking any lock,
+     * the buffers are only read by the main thread in EndFrame() and DumpChromeTrace(), which discard
+     * the events overwritten while being read. The buffer of a thread is reused by another thread once
+     * the first one has exited, so short-lived threads do not accumulate buffers.
+     * Scope names must have static storage duration (string literals), they are stored as is.
+     */
+    class Profiler
+    {
+      public:
+        static constexpr uint32_t BufferCapacity = 8192;    ///< Number of events kept per thread (power of two).
+        static constexpr uint32_t HistoryCapacity = 256;    ///< Number of frames kept for the statistics.
+
+        /**
+         * @brief Struct representing a recorded scope.
+         */
+        struct Event
+        {
+            const char* name;       ///< Name of the scope.
+            int64_t start;          ///< Start time in nanoseconds since the creation of the profiler.
+            int64_t end;            ///< End time in nanoseconds since the creation of the profiler.
+        };
+
+        /**
+         * @brief Struct representing the statistics of a scope over the last frames, in milliseconds.
+         *        When a scope is recorded several times in a frame, the durations are summed for that frame.
+         */
+        struct Stats
+        {
+            float min = 0;          ///< Minimum time spent per frame.
+            float avg = 0;          ///< Average time spent per frame.
+            float p99 = 0;          ///< 99th percentile of the time spent per frame.
+            float last = 0;         ///< Time spent during the last frame.
+            uint32_t samples = 0;   ///< Number of frames taken into account.
+        };
+
+        /**
+         * @brief RAII helper recording the time between its construction and its destruction.
+         */
+        class Scope
+        {
+          private:
+            Profiler *profiler;     ///< Profiler receiving the event, nullptr if the profiler is disabled.
+            const char *name;       ///< Name of the scope.
+            int64_t start;          ///< Start time of the scope.
+
+          public:
+            Scope(Profiler& profiler, const char* name)
+            : profiler(profiler.IsEnabled() ? &profiler : nullptr)
+            , name(name), start(0)
+            {
+                if (this->profiler) start = profiler.Now();
+            }
+
+            ~Scope()
+            {
+                if (profiler) profiler->Record(name, start, profiler->Now());
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+      private:
+        /**
+         * @brief Event of a ring buffer, atomic so that it can be read while the owner thread overwrites it.
+         */
+        struct Slot
+        {
+            std::atomic<const char*> name{nullptr};     ///< Name of the scope.
+            std::atomic<int64_t> start{0};              ///< Start time of the scope.
+            std::atomic<int64_t> end{0};                ///< End time of the scope.
+        };
+
+        /**
+         * @brief Single producer ring buffer owned by one thread at a time.
+         */
+        struct ThreadBuffer
+        {
+            std::array<Slot, BufferCapacity> events;    ///< Recorded events.
+            std::atomic<uint64_t> head{0};              ///< Total number of events written (only modified by the owner thread).
+            std::atomic<bool> released{false};          ///< Flag set when the owner thread exits, the buffer can then be reused.
+            uint64_t tail = 0;                          ///< Number of events already consumed by EndFrame().
+            uint64_t profiler = 0;                      ///< Identifier of the profiler the buffer belongs to.
+            uint32_t tid = 0;                           ///< Index of the thread in the trace.
+            std::string name;                           ///< Name of the thread in the trace.
+        };
+
+        /**
+         * @brief Buffers used by a thread (one per profiler), released when the thread exits.
+         */
+        struct ThreadOwner
+        {
+            ThreadBuffer *cached = nullptr;                     ///< Buffer of the last profiler recorded into.
+            std::vector<std::shared_ptr<ThreadBuffer>> owned;   ///< Buffers currently owned by the thread.
+
+            ~ThreadOwner()
+            {
+                for (auto& buffer : owned) buffer->released.store(true, std::memory_order_release);
+            }
+        };
+
+        /**
+         * @brief Per-frame durations history of a scope.
+         */
+        struct Series
+        {
+            std::array<float, HistoryCapacity> values{};    ///< Durations per frame in milliseconds.
+            uint32_t count = 0;                             ///< Number of frames written.
+            float current = 0;                              ///< Accumulated duration for the frame in progress.
+            uint64_t frame = 0;                             ///< Index of the last frame the scope was recorded in.
+            bool touched = false;                           ///< Flag indicating whether the scope was recorded during the frame in progress.
+        };
+
+      private:
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;     ///< Buffers of all the threads that recorded an event.
+        std::unordered_map<std::string_view, Series> series;    ///< History of each scope name.
+        mutable std::mutex mutex;                               ///< Protects the list of buffers and the consumption of events.
+        const int64_t origin;                                   ///< Creation time of the profiler in nanoseconds.
+        const uint64_t id;                                      ///< Unique identifier used to retrieve the buffer of a thread.
+        const std::thread::id mainThread;                       ///< Thread which created the profiler, named "Main" in the trace.
+        uint64_t frameCount = 0;                                ///< Number of frames consumed by EndFrame().
+        std::atomic<bool> enabled{false};                       ///< Flag indicating whether events are recorded.
+
+      private:
+        ThreadBuffer& GetThreadBuffer();
+        static bool ReadEvent(const ThreadBuffer& buffer, uint64_t index, Event& event);
+
+      public:
+        Profiler();
+        ~Profiler() = default;
+
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        /**
+         * @brief Enables or disables the recording of events.
+         * @param value True to enable the profiler, false to disable it.
+         */
+        void SetEnabled(bool value)
+        {
+            enabled.store(value, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Checks if the profiler is recording events.
+         * @return True if enabled, false otherwise.
+         */
+        bool IsEnabled() const
+        {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the current time relative to the creation of the profiler.
+         * @return The time in nanoseconds.
+         */
+        int64_t Now() const;
+
+        /**
+         * @brief Sets the name of the calling thread as it will appear in the trace.
+         * @param name The name of the thread.
+         */
+        void SetThreadName(const std::string& name);
+
+        /**
+         * @brief Records an event for the calling thread. Lock-free once the thread buffer exists.
+         * @param name The name of the scope (static storage duration).
+         * @param start Start time obtained with Now().
+         * @param end End time obtained with Now().
+         */
+        void Record(const char* name, int64_t start, int64_t end);
+
+        /**
+         * @brief Consumes the events recorded since the previous call and updates the statistics.
+         *        Called once per frame by core::App, on the main thread.
+         */
+        void EndFrame();
+
+        /**
+         * @brief Discards the events not consumed yet and clears the statistics of all scopes.
+         */
+        void ResetStats();
+
+        /**
+         * @brief Gets the statistics of the given scope over the last frames.
+         * @param name The name of the scope.
+         * @return The statistics, with 'samples' at zero if the scope was never recorded.
+         */
+        Stats GetStats(std::string_view name) const;
+
+        /**
+         * @brief Gets the time spent in each scope during the last frame consumed by EndFrame(),
+         *        e.g. to aggregate more frames than the history keeps.
+         * @return The scopes recorded during that frame, with their duration in milliseconds.
+         */
+        std::vector<std::pair<std::string_view, float>> GetLastFrame() const;
+
+        /**
+         * @brief Gets the names of all the scopes recorded so far.
+         * @return A vector of scope names.
+         */
+        std::vector<std::string_view> GetScopeNames() const;
+
+        /**
+         * @brief Writes the events still present in the ring buffers in the Chrome trace event format,
+         *        readable with about://tracing or https://ui.perfetto.dev.
+         * @param fileName The path of the JSON file to write.
+         * @return True if the file was written successfully, false otherwise.
+         */
+        bool DumpChromeTrace(const std::string& fileName) const;
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_PROFILER_HPP
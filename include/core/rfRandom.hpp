@@ -3,26 +3,275 @@
 
 #include <Vector2.hpp>
 #include <Color.hpp>
+#include <cstdint>
+#include <cstddef>
 #include <random>
 #include <chrono>
 
+#if defined(_MSC_VER) && !defined(__SIZEOF_INT128__)
+#   include <intrin.h>
+#endif
+
 namespace rf { namespace core {
 
     /**
-     * @brief The RandomGenerator class provides functionality for generating random values.
+     * @brief Advances a SplitMix64 state and returns its next output, used to expand a seed into a larger state.
+     * @param state The state to advance.
+     * @return A well mixed 64 bits value.
+     */
+    inline uint64_t SplitMix64(uint64_t& state)
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief The Xoshiro256pp class is the xoshiro256++ engine (Blackman & Vigna), 32 bytes of state,
+     *        a period of 2^256 - 1 and a few cycles per draw.
+     *
+     * Satisfies the UniformRandomBitGenerator requirements, so it can be used with the standard distributions.
+     */
+    class Xoshiro256pp
+    {
+      public:
+        using result_type = uint64_t;
+
+      private:
+        uint64_t s[4];              ///< State, never entirely zero.
+
+      private:
+        static uint64_t Rotl(uint64_t x, int k)
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+      public:
+        /**
+         * @brief Constructs the engine from a seed.
+         * @param seed The seed, expanded with SplitMix64.
+         */
+        explicit Xoshiro256pp(uint64_t seed = 1)
+        {
+            Seed(seed);
+        }
+
+        /**
+         * @brief Resets the state from a seed.
+         * @param seed The seed, expanded with SplitMix64.
+         */
+        void Seed(uint64_t seed)
+        {
+            for (uint64_t& word : s) word = SplitMix64(seed);
+        }
+
+        /**
+         * @brief Advances the state by 2^128 draws, to get 2^128 non-overlapping streams (e.g. one per thread).
+         */
+        void Jump();
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return UINT64_MAX; }
+
+        result_type operator()()
+        {
+            const uint64_t result = Rotl(s[0] + s[3], 23) + s[0];
+            const uint64_t t = s[1] << 17;
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = Rotl(s[3], 45);
+
+            return result;
+        }
+    };
+
+    /**
+     * @brief The Pcg64 class is the PCG64 engine (PCG XSL RR 128/64, O'Neill), a 128 bits LCG with a permuted output,
+     *        a period of 2^128 and a constant time Advance().
+     *
+     * Satisfies the UniformRandomBitGenerator requirements, so it can be used with the standard distributions.
+     */
+    class Pcg64
+    {
+      public:
+        using result_type = uint64_t;
+
+      private:
+        static constexpr uint64_t MultiplierLo = 0x4385df649fccf645ull;
+        static constexpr uint64_t MultiplierHi = 0x2360ed051fc65da4ull;
+
+      private:
+        uint64_t stateLo, stateHi;  ///< State of the LCG.
+        uint64_t incLo, incHi;      ///< Increment of the LCG (odd), selects the stream.
+
+      private:
+        static uint64_t MulHi(uint64_t a, uint64_t b)
+        {
+#       if defined(__SIZEOF_INT128__)
+            return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#       elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+            return __umulh(a, b);
+#       else
+            const uint64_t aLo = a & 0xffffffff, aHi = a >> 32;
+            const uint64_t bLo = b & 0xffffffff, bHi = b >> 32;
+            const uint64_t mid = (aLo * bLo >> 32) + (aHi * bLo & 0xffffffff) + aLo * bHi;
+            return aHi * bHi + (aHi * bLo >> 32) + (mid >> 32);
+#       endif
+        }
+
+        /**
+         * @brief Computes the low 128 bits of (hi, lo) * (mulHi, mulLo) + (addHi, addLo).
+         */
+        static void MulAdd(uint64_t& lo, uint64_t& hi, uint64_t mulLo, uint64_t mulHi, uint64_t addLo, uint64_t addHi)
+        {
+            const uint64_t productHi = MulHi(lo, mulLo) + lo * mulHi + hi * mulLo;
+            const uint64_t productLo = lo * mulLo;
+
+            lo = productLo + addLo;
+            hi = productHi + addHi + (lo < productLo);
+        }
+
+        void Step()
+        {
+            MulAdd(stateLo, stateHi, MultiplierLo, MultiplierHi, incLo, incHi);
+        }
+
+      public:
+        /**
+         * @brief Constructs the engine from a seed.
+         * @param seed The seed, expanded with SplitMix64 into the state and the stream.
+         */
+        explicit Pcg64(uint64_t seed = 1)
+        {
+            Seed(seed);
+        }
+
+        /**
+         * @brief Resets the state and the stream from a seed.
+         * @param seed The seed, expanded with SplitMix64 into the state and the stream.
+         */
+        void Seed(uint64_t seed);
+
+        /**
+         * @brief Advances the state by any number of draws in logarithmic time.
+         * @param deltaLo Low 64 bits of the number of draws.
+         * @param deltaHi High 64 bits of the number of draws.
+         */
+        void Advance(uint64_t deltaLo, uint64_t deltaHi = 0);
+
+        /**
+         * @brief Advances the state by 2^64 draws, to get 2^64 non-overlapping streams (e.g. one per thread).
+         */
+        void Jump()
+        {
+            Advance(0, 1);
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return UINT64_MAX; }
+
+        result_type operator()()
+        {
+            Step();
+
+            const uint64_t xored = stateHi ^ stateLo;
+            const unsigned rot = static_cast<unsigned>(stateHi >> 58);
+            return (xored >> rot) | (xored << ((64 - rot) & 63));
+        }
+    };
+
+    /**
+     * @brief The RandomLanes class holds four xoshiro256++ streams advanced together to fill arrays of floats
+     *        with SIMD instructions (AVX2 if enabled at compile time, SSE2, or scalar code otherwise).
+     *        All the paths produce the same values.
      */
-    class RandomGenerator
+    class RandomLanes
     {
       private:
-        std::mt19937 generator;     ///< Mersenne Twister 19937 random number generator.
+        alignas(32) uint64_t state[4][4];   ///< Words of the states, by word then by lane.
+
+      public:
+        /**
+         * @brief Seeds the four streams from the draws of another engine.
+         * @param engine The engine to draw the seeds from.
+         */
+        template <typename _Engine>
+        void Seed(_Engine& engine)
+        {
+            for (auto& word : state)
+            {
+                for (uint64_t& lane : word)
+                {
+                    uint64_t seed = engine();
+                    lane = SplitMix64(seed);
+                }
+            }
+        }
+
+        /**
+         * @brief Fills an array of floats with uniform values in [min, max).
+         *
+         * The bounds can vary with the position of the value, to fill arrays of vectors:
+         * the value at index i is drawn between min[i % period] and min[i % period] + scale[i % period].
+         *
+         * @param values The array to fill.
+         * @param count The number of floats to fill.
+         * @param min The lower bounds, 'period' values.
+         * @param scale The sizes of the ranges, 'period' values.
+         * @param period The number of bounds, from 1 to 3.
+         */
+        void Fill(float* values, std::size_t count, const float* min, const float* scale, int period);
+    };
+
+    /**
+     * @brief The BasicRandomGenerator class provides functionality for generating random values.
+     *
+     * To draw from several threads, give each thread its own copy of a generator on which Jump() was called
+     * a different number of times, the streams are then guaranteed to never overlap.
+     *
+     * @tparam _Engine The engine, core::Xoshiro256pp or core::Pcg64.
+     */
+    template <typename _Engine>
+    class BasicRandomGenerator
+    {
+      private:
+        _Engine generator;          ///< Random number engine.
         unsigned long seed;         ///< Seed used for the random number generator.
+        RandomLanes lanes;          ///< Streams of the bulk fills, seeded from the engine by the first fill.
+        bool lanesSeeded = false;   ///< Flag indicating whether the streams of the bulk fills are seeded.
+
+      private:
+        RandomLanes& GetLanes()
+        {
+            if (!lanesSeeded)
+            {
+                lanes.Seed(generator);
+                lanesSeeded = true;
+            }
+            return lanes;
+        }
+
+        /**
+         * @brief Draws a floating-point value in [0, 1) from the full precision of its mantissa.
+         */
+        template <typename T>
+        T Canonical()
+        {
+            if constexpr (sizeof(T) <= sizeof(float)) return static_cast<T>(generator() >> 40) * 0x1.0p-24f;
+            else return static_cast<T>(generator() >> 11) * 0x1.0p-53;
+        }
 
       public:
         /**
-         * @brief Constructs a RandomGenerator with an optional seed.
+         * @brief Constructs a BasicRandomGenerator with an optional seed.
          * @param seed The seed for the random number generator. If not provided, it is generated from the current time.
          */
-        RandomGenerator(unsigned long seed = 0)
+        BasicRandomGenerator(unsigned long seed = 0)
         {
             SetSeed(seed);
         }
@@ -50,10 +299,29 @@ namespace rf { namespace core {
                 seed = std::chrono::duration_cast<std::chrono::milliseconds>(
                     std::chrono::system_clock::now().time_since_epoch()).count();
             }
-            generator.seed(seed);
+            generator.Seed(seed);
+            lanesSeeded = false;
             this->seed = seed;
         }
 
+        /**
+         * @brief Moves the generator to the next of its non-overlapping streams (see Xoshiro256pp::Jump() and Pcg64::Jump()).
+         */
+        void Jump()
+        {
+            generator.Jump();
+            lanesSeeded = false;
+        }
+
+        /**
+         * @brief Gets the underlying engine, e.g. to use it with the standard distributions.
+         * @return A reference to the engine.
+         */
+        _Engine& GetEngine()
+        {
+            return generator;
+        }
+
         /**
          * @brief Gets the current seed used by the random number generator.
          * @return The current seed.
@@ -87,8 +355,7 @@ namespace rf { namespace core {
         template <typename T>
         T Random(T min, T max, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr)
         {
-            std::uniform_real_distribution<T> distribution(min, max);
-            return distribution(generator);
+            return min + (max - min) * Canonical<T>();
         }
 
         /**
@@ -99,9 +366,7 @@ namespace rf { namespace core {
          */
         Vector2 RandomVec2(const Vector2& min, const Vector2& max)
         {
-            std::uniform_real_distribution<float> distX(min.x, max.x);
-            std::uniform_real_distribution<float> distY(min.y, max.y);
-            return { distX(generator), distY(generator) };
+            return { Random(min.x, max.x), Random(min.y, max.y) };
         }
 
         /**
@@ -112,10 +377,7 @@ namespace rf { namespace core {
          */
         Vector3 RandomVec3(const Vector3& min, const Vector3& max)
         {
-            std::uniform_real_distribution<float> distX(min.x, max.x);
-            std::uniform_real_distribution<float> distY(min.y, max.y);
-            std::uniform_real_distribution<float> distZ(min.z, max.z);
-            return { distX(generator), distY(generator), distZ(generator) };
+            return { Random(min.x, max.x), Random(min.y, max.y), Random(min.z, max.z) };
         }
 
         /**
@@ -126,8 +388,52 @@ namespace rf { namespace core {
          */
         Color RandomColor(float sat = 1.0, float val = 1.0)
         {
-            std::uniform_real_distribution<float> distribution(0, 360);
-            return raylib::Color::FromHSV(distribution(generator), sat, val);
+            return raylib::Color::FromHSV(360.0f * Canonical<float>(), sat, val);
+        }
+
+        /**
+         * @brief Fills an array with random floating-point values within the specified range, several at a time with SIMD instructions.
+         * @param values The array to fill.
+         * @param count The number of values to generate.
+         * @param min The minimum value of the range.
+         * @param max The maximum value of the range.
+         */
+        void FillFloats(float* values, std::size_t count, float min, float max)
+        {
+            const float scale = max - min;
+            GetLanes().Fill(values, count, &min, &scale, 1);
+        }
+
+        /**
+         * @brief Fills an array with random Vector2 within the specified range, several at a time with SIMD instructions.
+         * @param values The array to fill.
+         * @param count The number of vectors to generate.
+         * @param min The minimum values of the range for x and y.
+         * @param max The maximum values of the range for x and y.
+         */
+        void FillVec2(Vector2* values, std::size_t count, const Vector2& min, const Vector2& max)
+        {
+            static_assert(sizeof(Vector2) == 2 * sizeof(float), "Vector2 must be made of two packed floats");
+
+            const float mins[2] = { min.x, min.y };
+            const float scales[2] = { max.x - min.x, max.y - min.y };
+            GetLanes().Fill(reinterpret_cast<float*>(values), 2 * count, mins, scales, 2);
+        }
+
+        /**
+         * @brief Fills an array with random Vector3 within the specified range, several at a time with SIMD instructions.
+         * @param values The array to fill.
+         * @param count The number of vectors to generate.
+         * @param min The minimum values of the range for x, y, and z.
+         * @param max The maximum values of the range for x, y, and z.
+         */
+        void FillVec3(Vector3* values, std::size_t count, const Vector3& min, const Vector3& max)
+        {
+            static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be made of three packed floats");
+
+            const float mins[3] = { min.x, min.y, min.z };
+            const float scales[3] = { max.x - min.x, max.y - min.y, max.z - min.z };
+            GetLanes().Fill(reinterpret_cast<float*>(values), 3 * count, mins, scales, 3);
         }
 
         /**
@@ -175,6 +481,8 @@ namespace rf { namespace core {
         }
     };
 
+    using RandomGenerator = BasicRandomGenerator<Xoshiro256pp>;
+
 }}
 
 #endif //RAYFLEX_CORE_RANDOM_HPP
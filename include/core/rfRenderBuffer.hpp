@@ -0,0 +1,63 @@
+#ifndef RAYFLEX_CORE_RENDER_BUFFER_HPP
+#define RAYFLEX_CORE_RENDER_BUFFER_HPP
+
+#include "./rfFrameArena.hpp"
+
+#include <cstdint>
+#include <array>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The RenderBuffer class double-buffers the render data a state produces in State::Update() for State::Draw().
+     *
+     * Update() writes into GetBack() while Draw() only reads GetFront(), and State::Sync() publishes
+     * the new data with Swap(). When core::App runs pipelined (see App::SetPipelined()), the Update() of the next
+     * frame runs on a worker thread while the Draw() of the current frame runs on the main thread, so they
+     * must only communicate through such buffers. After a swap the back buffer holds the data of two frames ago,
+     * Update() is expected to rewrite it entirely (e.g. clear and fill a vector, keeping its capacity).
+     * For the same reason the data must not be allocated from the core::FrameArena, which only keeps
+     * the memory of the current and previous frames (rejected at compile time for FrameVector and FrameString).
+     *
+     * @tparam T Type of the render data (transforms, sprites to draw, camera...).
+     */
+    template <typename T>
+    class RenderBuffer
+    {
+        static_assert(!IsFrameContainer<T>::value, "The back buffer outlives the frame memory, use a standard allocator");
+
+      private:
+        std::array<T, 2> buffers{};     ///< Front and back buffers.
+        uint8_t front = 0;              ///< Index of the front buffer.
+
+      public:
+        /**
+         * @brief Gets the buffer written by Update().
+         * @return A reference to the back buffer.
+         */
+        T& GetBack()
+        {
+            return buffers[front ^ 1];
+        }
+
+        /**
+         * @brief Gets the buffer read by Draw(), i.e. the last published data.
+         * @return A const reference to the front buffer.
+         */
+        const T& GetFront() const
+        {
+            return buffers[front];
+        }
+
+        /**
+         * @brief Publishes the back buffer, to be called from State::Sync() only.
+         */
+        void Swap()
+        {
+            front ^= 1;
+        }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_RENDER_BUFFER_HPP
@@ -0,0 +1,107 @@
+#ifndef RAYFLEX_CORE_RENDER_TARGET_POOL_HPP
+#define RAYFLEX_CORE_RENDER_TARGET_POOL_HPP
+
+#include <raylib.h>
+#include <cstdint>
+#include <vector>
+
+namespace rf { namespace core {
+
+    /**
+     * @brief The RenderTargetPool class recycles render targets (color texture + depth buffer) keyed by size and format.
+     *
+     * Targets are borrowed with Acquire() and given back with Release() instead of being loaded and unloaded,
+     * so that temporary targets (transitions, post-processing passes...) and resolution changes back and forth
+     * do not reallocate GPU memory. Released targets that are not borrowed again within a few frames are unloaded
+     * by Collect(), which core::App calls once per frame for its own pool.
+     *
+     * All the methods must be called from the thread owning the GL context.
+     */
+    class RenderTargetPool
+    {
+      private:
+        /**
+         * @brief Target waiting in the pool to be borrowed again.
+         */
+        struct Available
+        {
+            ::RenderTexture target;     ///< The render target.
+            uint64_t releaseFrame;      ///< Frame at which the target was released.
+        };
+
+      private:
+        std::vector<Available> available;   ///< Targets released and not yet unloaded.
+        uint64_t frame = 0;                 ///< Number of calls to Collect().
+        uint32_t acquiredCount = 0;         ///< Number of targets currently borrowed.
+        uint32_t maxIdleFrames = 60;        ///< Number of frames a released target is kept before being unloaded.
+
+      public:
+        RenderTargetPool() = default;
+
+        /**
+         * @brief Destructor, unloads the available targets. Borrowed targets must have been released before.
+         */
+        ~RenderTargetPool()
+        {
+            Clear();
+        }
+
+        RenderTargetPool(const RenderTargetPool&) = delete;
+        RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+        /**
+         * @brief Borrows a render target, reusing an available one of the same size and format if any.
+         * @param width The width of the target.
+         * @param height The height of the target.
+         * @param format The pixel format of the color texture (PixelFormat, default is RGBA8).
+         * @return The render target, with id zero if it could not be created.
+         */
+        ::RenderTexture Acquire(int width, int height, int format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+        /**
+         * @brief Gives a borrowed render target back to the pool. Its content is kept until it is borrowed again.
+         * @param target The render target to release, ignored if its id is zero.
+         */
+        void Release(const ::RenderTexture& target);
+
+        /**
+         * @brief Advances the frame counter and unloads the targets released for more than the idle limit.
+         */
+        void Collect();
+
+        /**
+         * @brief Unloads all the available targets immediately.
+         */
+        void Clear();
+
+        /**
+         * @brief Sets the number of frames a released target is kept in the pool before being unloaded.
+         * @param frames The number of frames (default is 60), zero unloads the targets at the next Collect().
+         */
+        void SetMaxIdleFrames(uint32_t frames)
+        {
+            maxIdleFrames = frames;
+        }
+
+        /**
+         * @brief Gets the number of targets currently borrowed.
+         * @return The number of borrowed targets.
+         */
+        uint32_t GetAcquiredCount() const
+        {
+            return acquiredCount;
+        }
+
+        /**
+         * @brief Gets the number of targets available in the pool.
+         * @return The number of available targets.
+         */
+        uint32_t GetAvailableCount() const
+        {
+            return static_cast<uint32_t>(available.size());
+        }
+    };
+
+}}
+
+#endif //RAYFLEX_CORE_RENDER_TARGET_POOL_HPP
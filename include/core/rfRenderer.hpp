@@ -1,7 +1,13 @@
 #ifndef RAYFLEX_CORE_RENDERER_HPP
 #define RAYFLEX_CORE_RENDERER_HPP
 
+#include "./rfRenderTargetPool.hpp"
+#include "./rfPostProcessChain.hpp"
+
 #include <RenderTexture.hpp>
+#include <algorithm>
+#include <utility>
+#include <rlgl.h>
 
 namespace rf { namespace core {
 
@@ -9,11 +15,24 @@ namespace rf { namespace core {
      * @brief The Renderer class facilitates the use of RenderTextures for final screen rendering.
      * It provides functionality to manage scaling, aspect ratio, and internal rendering offset.
      * This class is primarily used internally but can also be optionally used by the framework's users.
+     *
+     * The target can be borrowed from a core::RenderTargetPool (see SetPool()), in which case Unload() and Resize()
+     * give it back to the pool instead of unloading it. The size and settings are kept while the target is unloaded,
+     * so that it can be loaded again later with Load().
+     *
+     * The target can also be rendered at a fraction of its size with SetRenderScale() (dynamic resolution).
+     * The size, the conversions and the 2D drawing between BeginMode() and EndMode() remain in logical coordinates,
+     * 3D drawing adapts by itself to the size of the target. Only BeginMode2D() resets the scaling,
+     * the zoom of the camera must then be multiplied by GetRenderScale().
      */
     class Renderer {
 
       private:
-        raylib::RenderTexture target;   ///< The target RenderTexture for rendering.
+        ::RenderTexture target;         ///< The target RenderTexture for rendering.
+        RenderTargetPool *pool;         ///< Pool the target is borrowed from, if any.
+        int width;                      ///< Width of the target, kept while unloaded.
+        int height;                     ///< Height of the target, kept while unloaded.
+        float renderScale;              ///< Scale of the target size relative to the logical size.
         raylib::Vector2 offset;         ///< The rendering offset.
         raylib::Vector2 scale;          ///< The rendering scale.
         float aspectRatio;              ///< The aspect ratio of the rendering.
@@ -56,7 +75,7 @@ namespace rf { namespace core {
          */
         Rectangle GetRecSrc() const
         {
-            return { 0.0f, 0.0f, GetWidth(), -GetHeight() };
+            return { 0.0f, 0.0f, static_cast<float>(target.texture.width), -static_cast<float>(target.texture.height) };
         }
 
         /**
@@ -88,8 +107,8 @@ namespace rf { namespace core {
         void UpdateOffset()
         {
             const float minScale = GetMinScale();
-            offset.x = (GetDestWidth() - target.texture.width * minScale) * 0.5f;
-            offset.y = (GetDestHeight() - target.texture.height * minScale) * 0.5f;
+            offset.x = (GetDestWidth() - width * minScale) * 0.5f;
+            offset.y = (GetDestHeight() - height * minScale) * 0.5f;
         }
 
         /**
@@ -97,9 +116,29 @@ namespace rf { namespace core {
          */
         void UpdateAspectRatio()
         {
-            aspectRatio = (target.texture.width > target.texture.height)
-                ? static_cast<float>(target.texture.width) / static_cast<float>(target.texture.height)
-                : static_cast<float>(target.texture.height) / static_cast<float>(target.texture.width);
+            aspectRatio = (width > height)
+                ? static_cast<float>(width) / static_cast<float>(height)
+                : static_cast<float>(height) / static_cast<float>(width);
+        }
+
+        /**
+         * @brief Loads the target with the current size and render scale, from the pool if any.
+         */
+        void AcquireTarget()
+        {
+            const int w = GetTargetWidth(), h = GetTargetHeight();
+            target = pool ? pool->Acquire(w, h) : LoadRenderTexture(w, h);
+        }
+
+        /**
+         * @brief Unloads the target, or gives it back to the pool if any.
+         */
+        void ReleaseTarget()
+        {
+            if (target.id == 0) return;
+            if (pool) pool->Release(target);
+            else UnloadRenderTexture(target);
+            target = ::RenderTexture{};
         }
 
       public:
@@ -107,14 +146,14 @@ namespace rf { namespace core {
          * @brief Default constructor for the Renderer class.
          * Initializes the target RenderTexture, offset, scale, aspect ratio, and keepRatio flag.
          */
-        Renderer() : target(), offset(), scale(), aspectRatio(0), keepRatio(0) { }
+        Renderer() : target(), pool(nullptr), width(0), height(0), renderScale(1.0f), offset(), scale(), aspectRatio(0), keepRatio(0) { }
 
         /**
          * @brief Parameterized constructor for the Renderer class.
          * @param size The initial size of the RenderTexture.
          * @param keepRatio Flag indicating whether to maintain aspect ratio during rendering.
          */
-        Renderer(const Vector2& size, bool keepRatio)
+        Renderer(const Vector2& size, bool keepRatio) : Renderer()
         {
             Load(static_cast<int>(size.x), static_cast<int>(size.y), keepRatio);
         }
@@ -125,11 +164,56 @@ namespace rf { namespace core {
          * @param height The initial height of the RenderTexture.
          * @param keepRatio Flag indicating whether to maintain aspect ratio during rendering.
          */
-        Renderer(int width, int height, bool keepRatio)
+        Renderer(int width, int height, bool keepRatio) : Renderer()
         {
             Load(width, height, keepRatio);
         }
 
+        /**
+         * @brief Destructor, unloads the target or gives it back to the pool.
+         */
+        ~Renderer()
+        {
+            ReleaseTarget();
+        }
+
+        Renderer(const Renderer&) = delete;
+        Renderer& operator=(const Renderer&) = delete;
+
+        Renderer(Renderer&& other) noexcept
+        : target(std::exchange(other.target, ::RenderTexture{})), pool(other.pool)
+        , width(other.width), height(other.height), renderScale(other.renderScale), offset(other.offset), scale(other.scale)
+        , aspectRatio(other.aspectRatio), keepRatio(other.keepRatio)
+        { }
+
+        Renderer& operator=(Renderer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                ReleaseTarget();
+                target = std::exchange(other.target, ::RenderTexture{});
+                pool = other.pool, width = other.width, height = other.height, renderScale = other.renderScale;
+                offset = other.offset, scale = other.scale;
+                aspectRatio = other.aspectRatio, keepRatio = other.keepRatio;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Sets the pool from which the target is borrowed. A loaded target is reloaded through the new pool.
+         * @param pool The pool, or nullptr to load the target directly.
+         */
+        void SetPool(RenderTargetPool* pool)
+        {
+            if (this->pool == pool) return;
+
+            const bool loaded = IsReady();
+            ReleaseTarget();
+
+            this->pool = pool;
+            if (loaded) AcquireTarget();
+        }
+
         /**
          * @brief Loads the Renderer with the specified width, height, and aspect ratio preservation flag.
          * @param size The initial size of the RenderTexture.
@@ -148,23 +232,34 @@ namespace rf { namespace core {
          */
         void Load(int width, int height, bool keepRatio)
         {
-            this->target = raylib::RenderTexture(
-                width == 0 ? GetDestWidth() : width,
-                height == 0 ? GetDestHeight() : height);
+            ReleaseTarget();
 
+            this->width = width == 0 ? static_cast<int>(GetDestWidth()) : width;
+            this->height = height == 0 ? static_cast<int>(GetDestHeight()) : height;
             this->keepRatio = keepRatio;
 
+            AcquireTarget();
+
             UpdateScale();
             UpdateOffset();
             UpdateAspectRatio();
         }
 
         /**
-         * @brief Unloads the target RenderTexture.
+         * @brief Loads the target again with the current size and settings after Unload().
+         *        Does nothing if the target is already loaded or if the Renderer has never been loaded.
+         */
+        void Load()
+        {
+            if (target.id == 0 && width > 0 && height > 0) AcquireTarget();
+        }
+
+        /**
+         * @brief Unloads the target RenderTexture, or gives it back to the pool. The size and settings are kept.
          */
         void Unload()
         {
-            target.Unload();
+            ReleaseTarget();
         }
 
         /**
@@ -173,7 +268,7 @@ namespace rf { namespace core {
          */
         bool IsReady() const
         {
-            return target.IsReady();
+            return target.id > 0;
         }
 
         /**
@@ -200,7 +295,8 @@ namespace rf { namespace core {
          */
         Renderer& BeginMode()
         {
-            target.BeginMode();
+            BeginTextureMode(target);
+            if (renderScale != 1.0f) rlScalef(renderScale, renderScale, 1.0f);
             return *this;
         }
 
@@ -210,7 +306,7 @@ namespace rf { namespace core {
          */
         Renderer& EndMode()
         {
-            target.EndMode();
+            EndTextureMode();
             return *this;
         }
 
@@ -219,6 +315,7 @@ namespace rf { namespace core {
          */
         void Update()
         {
+            if (width == 0 || height == 0) return;
             UpdateScale();
             if (keepRatio) UpdateOffset();
             else UpdateAspectRatio();
@@ -233,6 +330,17 @@ namespace rf { namespace core {
             DrawTexturePro(target.texture, GetRecSrc(), GetRecDst(), { 0, 0 }, 0, tint);
         }
 
+        /**
+         * @brief Draws the target RenderTexture to the screen through a post-processing chain.
+         *        The intermediate targets are borrowed from the pool of the Renderer if any.
+         * @param chain The post-processing chain to apply.
+         * @param tint The tint color applied by the last pass.
+         */
+        void Draw(PostProcessChain& chain, Color tint = WHITE) const
+        {
+            chain.Apply(target.texture, GetRecSrc(), GetRecDst(), tint, pool);
+        }
+
         /**
          * @brief Sets whether to maintain aspect ratio during rendering.
          * @param enabled True to maintain aspect ratio; false otherwise.
@@ -241,6 +349,7 @@ namespace rf { namespace core {
         {
             if (keepRatio == enabled) return;
             keepRatio = enabled;
+            if (width == 0 || height == 0) return;
 
             UpdateScale();
             UpdateOffset();
@@ -258,16 +367,67 @@ namespace rf { namespace core {
 
         /**
          * @brief Resizes the target RenderTexture to the specified width and height.
+         *        If the target is unloaded, only the size is changed and used by the next Load().
          * @param width The new width of the RenderTexture.
          * @param height The new height of the RenderTexture.
          */
         void Resize(int width, int height)
         {
-            target.Unload();
-            target = raylib::RenderTexture(width, height);
+            if (this->width == width && this->height == height) return;
+
+            const bool loaded = IsReady();
+            ReleaseTarget();
+
+            this->width = width, this->height = height;
+            if (loaded) AcquireTarget();
+
             UpdateScale(); UpdateOffset(); UpdateAspectRatio();
         }
 
+        /**
+         * @brief Sets the scale of the target size relative to the logical size (dynamic resolution).
+         *        The target is reloaded at the new size if loaded, the logical size and conversions are unchanged.
+         * @param scale The render scale, clamped between 0.1 and 1 (default is 1).
+         */
+        void SetRenderScale(float scale)
+        {
+            scale = std::clamp(scale, 0.1f, 1.0f);
+            if (renderScale == scale) return;
+
+            const bool loaded = IsReady();
+            ReleaseTarget();
+
+            renderScale = scale;
+            if (loaded) AcquireTarget();
+        }
+
+        /**
+         * @brief Gets the scale of the target size relative to the logical size.
+         * @return The render scale (1 at full resolution).
+         */
+        float GetRenderScale() const
+        {
+            return renderScale;
+        }
+
+        /**
+         * @brief Gets the width in pixels of the target RenderTexture, i.e. the logical width times the render scale.
+         * @return The width of the target.
+         */
+        int GetTargetWidth() const
+        {
+            return std::max(1, static_cast<int>(width * renderScale + 0.5f));
+        }
+
+        /**
+         * @brief Gets the height in pixels of the target RenderTexture, i.e. the logical height times the render scale.
+         * @return The height of the target.
+         */
+        int GetTargetHeight() const
+        {
+            return std::max(1, static_cast<int>(height * renderScale + 0.5f));
+        }
+
         /**
          * @brief Gets a reference to the Texture2D of the target RenderTexture.
          * @return A const reference to the Texture2D of the target RenderTexture.
@@ -277,6 +437,15 @@ namespace rf { namespace core {
             return target.texture;
         }
 
+        /**
+         * @brief Gets a reference to the target RenderTexture (e.g. for core::FrameCapture).
+         * @return A const reference to the target RenderTexture, with id zero if unloaded.
+         */
+        const ::RenderTexture& GetRenderTexture() const
+        {
+            return target;
+        }
+
         /**
          * @brief Gets the current rendering offset.
          * @return The current rendering offset as a Vector2.
@@ -314,21 +483,21 @@ namespace rf { namespace core {
         }
 
         /**
-         * @brief Gets the current width of the target RenderTexture.
+         * @brief Gets the current logical width of the target RenderTexture.
          * @return The current width as a float.
          */
         float GetWidth() const
         {
-            return static_cast<float>(target.texture.width);
+            return static_cast<float>(width);
         }
 
         /**
-         * @brief Gets the current height of the target RenderTexture.
+         * @brief Gets the current logical height of the target RenderTexture.
          * @return The current height as a float.
          */
         float GetHeight() const
         {
-            return static_cast<float>(target.texture.height);
+            return static_cast<float>(height);
         }
 
         /**
@@ -2,10 +2,15 @@
 #define RAYFLEX_CORE_SAVE_MANAGER_HPP
 
 #include <raylib-cpp.hpp>
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <fstream>
 #include <cstring>
 #include <string>
+#include <thread>
+#include <vector>
+#include <mutex>
 
 namespace rf { namespace core {
 
@@ -30,6 +35,100 @@ namespace rf { namespace core {
         using IncompatibleVersionCallback = std::function<bool(const std::ifstream& file, const int version)>;
         IncompatibleVersionCallback onIncompatibleVersion;
 
+      public:
+        using WriteCallback = std::function<void(int result)>;
+
+      private:
+        /**
+         * @brief Snapshot waiting to be written by the writer thread.
+         */
+        struct PendingWrite
+        {
+            std::string path;                       ///< Path of the file to write.
+            std::string save;                       ///< Path of the save the file belongs to (itself or the save of a journal).
+            std::vector<char> buffer;               ///< Content of the file, or journal records to append.
+            std::vector<char> journal;              ///< If not empty, header of a new journal written once the snapshot is.
+            std::vector<WriteCallback> callbacks;   ///< Callbacks of all the requests coalesced into this write.
+            bool append;                            ///< Flag indicating whether the buffer is appended to the file.
+        };
+
+        std::vector<PendingWrite> pendingWrites;    ///< Writes not started yet, in the order they must be done.
+        std::thread writer;                         ///< Writer thread, started by the first WriteAsync().
+        std::mutex writeMutex;                      ///< Protects the pending writes and the writer state.
+        std::condition_variable writeCondition;     ///< Signals new writes to the writer and completions to Flush().
+        bool writing = false;                       ///< Flag indicating whether the writer is writing a file.
+        std::string writingSave;                    ///< Save of the write in progress, if any.
+        bool stopWriter = false;                    ///< Flag asking the writer thread to exit once idle.
+        std::atomic<bool> journalFailed{false};     ///< Flag set by the writer when an asynchronous journaled write failed.
+
+      private:
+        std::vector<char> journalBase;              ///< Save data as last journaled, used to find the dirty regions.
+        std::string journalPath;                    ///< Path of the save whose journal can be appended, empty if none.
+        std::size_t journalSize = 0;                ///< Size of the records in the journal since the last compaction.
+        std::size_t journalCompaction = 0;          ///< Records size triggering a compaction, zero for the size of the save data.
+
+      private:
+        /**
+         * @brief Builds the content of a save file (version then data) from the current save data.
+         */
+        std::vector<char> Snapshot(std::size_t size) const
+        {
+            std::vector<char> buffer(sizeof(int) + size);
+            std::memcpy(buffer.data(), &version, sizeof(int));
+            std::memcpy(buffer.data() + sizeof(int), data, size);
+            return buffer;
+        }
+
+        /**
+         * @brief Writes a buffer to a temporary file, flushes it to the disk then renames it over the destination,
+         *        so that the destination always contains either the previous or the new save, even after a crash.
+         * @return An error code indicating the result of the operation.
+         */
+        static int WriteFileAtomic(const std::string& path, const std::vector<char>& buffer);
+
+        /**
+         * @brief Appends a buffer to a file and flushes it to the disk.
+         * @return An error code indicating the result of the operation.
+         */
+        static int AppendFile(const std::string& path, const std::vector<char>& buffer);
+
+        /**
+         * @brief Queues a write for the writer thread. If the last pending write of the same save targets the same file
+         *        the same way, the new buffer replaces its snapshot (or is concatenated to its records) instead.
+         */
+        void QueueWrite(PendingWrite write, WriteCallback callback);
+
+        /**
+         * @brief Waits until the pending and in progress writes of a save are done, so that a synchronous
+         *        write of this save is not overwritten by an older asynchronous one.
+         */
+        void FlushSave(const std::string& save);
+
+        /**
+         * @brief Appends the regions of the save data modified since the last journaling to the journal of a save,
+         *        or compacts the journal into a new snapshot of the save when it becomes too large.
+         * @return An error code indicating the result of the operation, always SUCCESS when asynchronous.
+         */
+        int Journal(const std::string& path, std::size_t size, bool async, WriteCallback callback);
+
+        /**
+         * @brief Applies the valid records of the journal of a save over the freshly loaded save data.
+         */
+        void ReplayJournal(const std::string& path, std::size_t size);
+
+        /**
+         * @brief Stops appending to the journal of a save whose snapshot is rewritten entirely.
+         */
+        void InvalidateJournal(const std::string& path)
+        {
+            if (journalPath == path) journalPath.clear();
+        }
+
+        /**
+         * @brief Loop of the writer thread.
+         */
+        void WriterLoop();
+
       public:
         /**
          * @brief Constructor for the SaveManager class.
@@ -51,13 +150,12 @@ namespace rf { namespace core {
 
         /**
          * @brief Destructor for the SaveManager class.
-         * Cleans up allocated memory and resources.
+         * Waits for the pending asynchronous writes, then cleans up allocated memory and resources.
          */
-        ~SaveManager()
-        {
-            operator delete(origin);
-            operator delete(data);
-        }
+        ~SaveManager();
+
+        SaveManager(const SaveManager&) = delete;
+        SaveManager& operator=(const SaveManager&) = delete;
 
         /**
          * @brief Sets the directory path for saving and loading files.
@@ -94,6 +192,8 @@ namespace rf { namespace core {
         template <typename _Ts>
         int Load(const std::string& fileName)
         {
+            InvalidateJournal(directory + fileName);
+
             // Open file in reading mode
             std::ifstream file(directory + fileName, std::ios::binary);
             if (!file.is_open()) return FILE_NOT_FOUND;
@@ -130,6 +230,9 @@ namespace rf { namespace core {
             // Close file
             file.close();
 
+            // Apply the changes journaled since this snapshot, if any
+            ReplayJournal(directory + fileName, sizeof(_Ts));
+
             return SUCCESS;
         }
 
@@ -142,22 +245,87 @@ namespace rf { namespace core {
         template <typename _Ts>
         int Write(const std::string& fileName)
         {
-            // Open file in write mode
-            std::ofstream file(directory + fileName, std::ios::binary);
-            if (!file.is_open()) return FILE_NOT_FOUND;
+            // Written through a temporary file so that a crash never leaves a truncated save,
+            // after the asynchronous writes of the same save which share this temporary file
+            FlushSave(directory + fileName);
+            InvalidateJournal(directory + fileName);
+            return WriteFileAtomic(directory + fileName, Snapshot(sizeof(_Ts)));
+        }
 
-            // Write version first to file then data
-            file.write(reinterpret_cast<char*>(&version), sizeof(int));
-            file.write(reinterpret_cast<char*>(data), sizeof(_Ts));
+        /**
+         * @brief Writes save data to a file on a background thread, without blocking the calling thread.
+         *
+         * The current save data is copied immediately, so it can be modified as soon as this function returns.
+         * The file is written the same crash-safe way as Write(). If a write of the same file is still pending
+         * (e.g. rapid autosaves), its snapshot is replaced by the new one and a single write is performed.
+         *
+         * @tparam _Ts The type of the save data.
+         * @param fileName The path to the file to write.
+         * @param callback Optional function called from the writer thread with the error code of the write,
+         *                 use core::App::PostToMainThread() from it to get back to the main thread.
+         */
+        template <typename _Ts>
+        void WriteAsync(const std::string& fileName, WriteCallback callback = nullptr)
+        {
+            InvalidateJournal(directory + fileName);
+            QueueWrite({ directory + fileName, directory + fileName, Snapshot(sizeof(_Ts)), {}, {}, false }, std::move(callback));
+        }
 
-            // Check if the write was successful
-            if (file.fail()) return WRITE_FAILURE;
+        /**
+         * @brief Writes save data to a file in journaled mode, intended for large save data where only a few fields
+         *        change between two saves.
+         *
+         * Instead of rewriting the whole save, only the regions modified since the previous journaled write
+         * are appended, with their offset, length and checksum, to a journal next to the save ('fileName.journal').
+         * Once the journal grows larger than the compaction threshold (see SetJournalCompaction()), the save file is
+         * rewritten entirely and the journal restarts empty. Load() replays the journal over the save file.
+         *
+         * The first journaled write of a save in a session (unless it was just loaded) always writes the whole save.
+         * A copy of the save data is kept to detect the modified regions.
+         *
+         * @tparam _Ts The type of the save data.
+         * @param fileName The path to the file to write.
+         * @return An error code indicating the result of the operation.
+         */
+        template <typename _Ts>
+        int WriteJournal(const std::string& fileName)
+        {
+            return Journal(directory + fileName, sizeof(_Ts), false, nullptr);
+        }
 
-            // Close file
-            file.close();
+        /**
+         * @brief Same as WriteJournal() but done on the writer thread, like WriteAsync().
+         *        The modified regions are found and copied immediately.
+         * @tparam _Ts The type of the save data.
+         * @param fileName The path to the file to write.
+         * @param callback Optional function called from the writer thread with the error code of the write.
+         */
+        template <typename _Ts>
+        void WriteJournalAsync(const std::string& fileName, WriteCallback callback = nullptr)
+        {
+            Journal(directory + fileName, sizeof(_Ts), true, std::move(callback));
+        }
 
-            return SUCCESS;
+        /**
+         * @brief Sets the size of the journal records beyond which the journal is compacted into the save file.
+         * @param bytes The threshold in bytes, zero (default) to use the size of the save data,
+         *              which bounds the written bytes to twice the size of the modifications.
+         */
+        inline void SetJournalCompaction(std::size_t bytes)
+        {
+            journalCompaction = bytes;
         }
+
+        /**
+         * @brief Blocks until all the asynchronous writes are done.
+         */
+        void Flush();
+
+        /**
+         * @brief Checks if asynchronous writes are pending or in progress.
+         * @return True if a write is not done yet, false otherwise.
+         */
+        bool IsWriting();
     };
 
 }}
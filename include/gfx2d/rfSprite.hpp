@@ -2,6 +2,7 @@
 #define RAYFLEX_GFX_2D_SPRITE_HPP
 #if defined(SUPPORT_GFX_2D) || defined(SUPPORT_GFX_3D)
 
+#include "../core/rfMemoryTracker.hpp"
 #include <raylib-cpp.hpp>
 #include <unordered_map>
 #include <cstdint>
@@ -19,7 +20,7 @@ namespace rf { namespace gfx2d {
         /**
          * @brief Struct representing an animation within the sprite.
          */
-        struct Animation
+        struct Animation : core::TrackedObject<core::MemoryTag::Sprites>
         {
             float speed;        ///< The animation speed.
             uint16_t count;     ///< The number of frames in the animation.
@@ -42,7 +43,7 @@ namespace rf { namespace gfx2d {
         /**
          * @brief Struct representing an instance of a sprite animation.
          */
-        struct Instance
+        struct Instance : core::TrackedObject<core::MemoryTag::Sprites>
         {
             raylib::Rectangle frameRec; ///< The current frame rectangle.
             Animation* animation;       ///< Pointer to the associated animation.
@@ -60,8 +61,13 @@ namespace rf { namespace gfx2d {
                 : frameRec(fr), animation(a), animTime(at), currentFrame(cf) { }
         };
 
-        using MapAnimations = std::unordered_map<std::string, std::unique_ptr<Animation>>; ///< Type alias for the map of animations.
-        using MapInstances = std::unordered_map<std::string, std::unique_ptr<Instance>>;   ///< Type alias for the map of animation instances.
+        // NOTE: The nodes of the maps are accounted to core::MemoryTag::Sprites
+        template <typename T>
+        using Map = std::unordered_map<std::string, std::unique_ptr<T>, std::hash<std::string>, std::equal_to<std::string>,
+                                       core::TrackedAllocator<std::pair<const std::string, std::unique_ptr<T>>, core::MemoryTag::Sprites>>;
+
+        using MapAnimations = Map<Animation>;   ///< Type alias for the map of animations.
+        using MapInstances = Map<Instance>;     ///< Type alias for the map of animation instances.
 
       protected:
         MapAnimations animations;       ///< Map of animation names to Animation objects.
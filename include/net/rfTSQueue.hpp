@@ -2,6 +2,7 @@
 #define RAYFLEX_NET_THREAD_SAFE_QUEUE_HPP
 #ifdef SUPPORT_NET
 
+#include "../core/rfMemoryTracker.hpp"
 #include <condition_variable>
 #include <deque>
 #include <mutex>
@@ -19,7 +20,7 @@ namespace rf { namespace net {
     {
       protected:
         std::mutex muxQueue;                    ///< Mutex for protecting access to the queue.
-        std::deque<T> deqQueue;                 ///< The underlying deque container to store items.
+        std::deque<T, core::TrackedAllocator<T, core::MemoryTag::Network>> deqQueue; ///< The underlying deque container to store items.
         std::condition_variable cvBlocking;     ///< Condition variable for blocking on empty queue.
         std::mutex muxBlocking;                 ///< Mutex for blocking condition variable.
 
@@ -2,6 +2,7 @@
 #define RAYFLEX_PHYS_3D_OBJECT_HPP
 #ifdef SUPPORT_PHYS_3D
 
+#include "../core/rfMemoryTracker.hpp"
 #include "LinearMath/btTransform.h"
 #include <btBulletDynamicsCommon.h>
 #include <raylib-cpp.hpp>
@@ -27,7 +28,7 @@ namespace rf { namespace phys3d {
     /**
      * @brief Class representing a 3D physics object.
      */
-    class Object
+    class Object : public core::TrackedObject<core::MemoryTag::Physics>
     {
       public:
         static constexpr float Static = 0.0f; ///< Constant representing a static object.
@@ -4,9 +4,24 @@
 #include <raylib-cpp.hpp>
 
 #include "core/rfApp.hpp"
+#include "core/rfCommandQueue.hpp"
+#include "core/rfCooked.hpp"
+#include "core/rfFrameArena.hpp"
+#include "core/rfFrameCapture.hpp"
+#include "core/rfFrameLimiter.hpp"
+#include "core/rfJobSystem.hpp"
+#include "core/rfMemoryTracker.hpp"
+#include "core/rfPostProcessChain.hpp"
+#include "core/rfProfiler.hpp"
 #include "core/rfRandom.hpp"
+#include "core/rfRenderBuffer.hpp"
 #include "core/rfRenderer.hpp"
+#include "core/rfRenderTargetPool.hpp"
 #include "core/rfSaveManager.hpp"
+#include "core/rfAssetId.hpp"
+#include "core/rfAssetPack.hpp"
+#include "core/rfAssetPool.hpp"
+#include "core/rfAssetTraits.hpp"
 #include "core/rfAssetManager.hpp"
 
 #ifdef SUPPORT_GFX_2D
@@ -1,4 +1,11 @@
 #include "core/rfApp.hpp"
+#include <RaylibException.hpp>
+#include <rlgl.h>
+
+#include <unordered_map>
+#include <algorithm>
+#include <utility>
+#include <cmath>
 
 #ifdef PLATFORM_WEB
 #   include <emscripten/emscripten.h>
@@ -7,37 +14,229 @@
 
 using namespace rf;
 
+/* LOADING STATE */
+
+bool core::LoadingState::IsJobsDone() const
+{
+    if (!jobsCounter.IsDone()) return false;
+
+    std::scoped_lock lock(jobsMutex);
+    return finalizers.empty();
+}
+
+void core::LoadingState::RunFinalizers(double budget)
+{
+    const double start = GetTime();
+
+    do
+    {
+        Finalizer finalizer;
+
+        {
+            std::scoped_lock lock(jobsMutex);
+            if (finalizers.empty()) return;
+            finalizer = std::move(finalizers.front());
+            finalizers.pop_front();
+        }
+
+        finalizer.first();
+
+        std::scoped_lock lock(jobsMutex);
+        doneWeight += finalizer.second;
+    }
+    while (GetTime() - start < budget);
+}
+
+void core::LoadingState::AddJob(std::function<void()> job, std::function<void()> finalize, float weight)
+{
+    {
+        std::scoped_lock lock(jobsMutex);
+        totalWeight += weight;
+    }
+
+    app->jobSystem.Run([this, job = std::move(job), finalize = std::move(finalize), weight]() {
+        job();
+        std::scoped_lock lock(jobsMutex);
+        if (finalize) finalizers.emplace_back(finalize, weight);
+        else doneWeight += weight;
+    }, &jobsCounter);
+}
+
+float core::LoadingState::GetProgress() const
+{
+    std::scoped_lock lock(jobsMutex);
+    return totalWeight > 0.0f ? doneWeight / totalWeight : 1.0f;
+}
+
 /* PRIVATE */
 
 void core::App::Init(const std::string& title, const Vector2& winSize, const Vector2& targetSize, bool keepAspectRatio, uint32_t flags, bool initAudio)
 {
-    window.Init(winSize.x, winSize.y, title, flags);
+    profiler.SetThreadName("Main");
+    assetManager.SetAsyncExecutors(&jobSystem, &mainQueue);
+
+    try
+    {
+        window.Init(winSize.x, winSize.y, title, flags);
+    }
+    catch (const raylib::RaylibException& e)
+    {
+        // A hidden window is only requested for offscreen/benchmark usage,
+        // in this case we continue without any window or render target
+        if (!(flags & FLAG_WINDOW_HIDDEN)) throw;
+        TraceLog(LOG_WARNING, "App::Init() -> Unable to create the window, running headless");
+        headless = true;
+        return;
+    }
+
+    // The pacing is done by the FrameLimiter rather than by raylib, Benchmark() frames are not paced
+    window.SetTargetFPS(0);
+
     if (initAudio) audio.Init();
 
+    renderer.SetPool(&renderTargets);
     renderer.Load(targetSize, keepAspectRatio);
-    rendererTransition.Load(targetSize, keepAspectRatio);
+
+    // The transition target is only borrowed from the pool during transitions and loading screens
+    rendererTransition.SetPool(&renderTargets);
+}
+
+int core::App::ConsumeFixedSteps(float dt)
+{
+    if (!fixedStepEnabled) return 0;
+
+    int steps = 0;
+    fixedStepAccumulator += dt;
+
+    while (fixedStepAccumulator >= fixedStepDelta && steps < fixedStepMaxSteps)
+    {
+        fixedStepAccumulator -= fixedStepDelta;
+        steps++;
+    }
+
+    // Drop the time we could not catch up to avoid a spiral of death
+    if (fixedStepAccumulator >= fixedStepDelta)
+    {
+        fixedStepAccumulator = std::fmod(fixedStepAccumulator, fixedStepDelta);
+    }
+
+    fixedStepAlpha = fixedStepAccumulator / fixedStepDelta;
+
+    return steps;
 }
 
 void core::App::UpdateAndDraw()
 {
-    currentState->second->Update(GetFrameTime());
+    const float dt = GetFrameTime();
 
-    renderer.BeginMode();
-        currentState->second->Draw(renderer);
-    renderer.EndMode();
+    {
+        RF_PROFILE_SCOPE(profiler, "State::FixedUpdate");
+        for (int steps = ConsumeFixedSteps(dt); steps > 0; steps--)
+        {
+            currentState->second->FixedUpdate(fixedStepDelta);
+        }
+    }
+
+    {
+        RF_PROFILE_SCOPE(profiler, "State::Update");
+        currentState->second->Update(dt);
+        currentState->second->Sync();
+    }
+
+    {
+        RF_PROFILE_SCOPE(profiler, "State::Draw");
+        renderer.BeginMode();
+            currentState->second->Draw(renderer, fixedStepAlpha);
+        renderer.EndMode();
+    }
 
     window.BeginDrawing().ClearBackground();
+    {
+        RF_PROFILE_SCOPE(profiler, "Renderer::Draw");
+
+        DrawMainRenderer();
+        DrawScreenOverlays();
+    }
+    {
+        RF_PROFILE_SCOPE(profiler, "EndDrawing");
+        frameDrawEnd = GetTime();
+        window.EndDrawing();
+    }
+}
+
+void core::App::UpdateAndDrawPipelined()
+{
+    State *state = currentState->second.get();
+
+    // First frame of this state, its first snapshot is produced serially
+    if (pipelineState != state)
+    {
+        pipelineState = state;
+        UpdateAndDraw();
+        return;
+    }
+
+    const float dt = GetFrameTime();
+    const float alpha = fixedStepAlpha;         // Interpolation factor of the snapshot being drawn
+    const int steps = ConsumeFixedSteps(dt);    // Consumed here, the accumulator is not touched by the job
 
-        if (shaderMain) shaderMain->BeginMode();
-            renderer.Draw();
-        if (shaderMain) shaderMain->EndMode();
+    // Simulation of the next frame, input and frame time are stable until EndDrawing()
+    // The assets are only read until the update is done, the reloads are posted meanwhile
+    assetManager.SetReloadsDeferred(true);
 
-        if (cursor.IsActive())
+    jobSystem.Run([this, state, dt, steps]() {
+        {
+            RF_PROFILE_SCOPE(profiler, "State::FixedUpdate");
+            for (int i = 0; i < steps; i++) state->FixedUpdate(fixedStepDelta);
+        }
         {
-            cursor.Draw(::GetMousePosition());
+            RF_PROFILE_SCOPE(profiler, "State::Update");
+            state->Update(dt);
         }
+    }, &pipelineCounter);
+
+    // Rendering of the current frame from the published snapshot
+    {
+        RF_PROFILE_SCOPE(profiler, "State::Draw");
+        renderer.BeginMode();
+            state->Draw(renderer, alpha);
+        renderer.EndMode();
+    }
+
+    window.BeginDrawing().ClearBackground();
+    {
+        RF_PROFILE_SCOPE(profiler, "Renderer::Draw");
+
+        DrawMainRenderer();
+        DrawScreenOverlays();
+    }
+
+    {
+        RF_PROFILE_SCOPE(profiler, "Pipeline::Wait");
+        jobSystem.Block(pipelineCounter);   // Does not run other jobs, e.g. asset decoding, meanwhile
+        assetManager.SetReloadsDeferred(false);
+        state->Sync();
+    }
+
+    {
+        RF_PROFILE_SCOPE(profiler, "EndDrawing");
+        frameDrawEnd = GetTime();
+        window.EndDrawing();
+    }
+}
 
-    window.EndDrawing();
+void core::App::CaptureTransitionSnapshot()
+{
+    RF_PROFILE_SCOPE(profiler, "Transition::Snapshot");
+
+    renderer.BeginMode();
+        currentState->second->Draw(renderer, fixedStepAlpha);
+    renderer.EndMode();
+
+    // The main effects are baked once into the snapshot
+    BakeMainEffects(renderer);
+
+    transitionSnapshotTaken = true;
 }
 
 void core::App::UpdateAndDrawTransition()
@@ -46,38 +245,63 @@ void core::App::UpdateAndDrawTransition()
     valTransitionProgress = std::min(
         valTransitionProgress + valTransitionInvDuration * dt, 1.0f);
 
-    // Update states
-    currentState->second->Update(dt);
-    nextState->second->Update(dt);
+    const bool live = (transitionMode == TransitionMode::Live);
 
-    // Render previous state
-    renderer.BeginMode();
-        currentState->second->Draw(renderer);
-    renderer.EndMode();
+    if (!live && !transitionSnapshotTaken)
+    {
+        CaptureTransitionSnapshot();
+    }
 
-    // Render next state
-    rendererTransition.BeginMode();
-        nextState->second->Draw(rendererTransition);
-    rendererTransition.EndMode();
+    // Update states, the outgoing one stays frozen in snapshot mode
+    {
+        RF_PROFILE_SCOPE(profiler, "State::FixedUpdate");
+        for (int steps = ConsumeFixedSteps(dt); steps > 0; steps--)
+        {
+            if (live) currentState->second->FixedUpdate(fixedStepDelta);
+            nextState->second->FixedUpdate(fixedStepDelta);
+        }
+    }
 
-    // Re-render both states if main shader is defined
-    if (shaderMain != nullptr)
     {
-        shaderMain->BeginMode();
+        RF_PROFILE_SCOPE(profiler, "State::Update");
+        if (live)
+        {
+            currentState->second->Update(dt);
+            currentState->second->Sync();
+        }
+        nextState->second->Update(dt);
+        nextState->second->Sync();
+    }
 
+    {
+        RF_PROFILE_SCOPE(profiler, "State::Draw");
+
+        // Render previous state
+        if (live)
+        {
             renderer.BeginMode();
-                renderer.Draw();
+                currentState->second->Draw(renderer, fixedStepAlpha);
             renderer.EndMode();
+        }
 
-            rendererTransition.BeginMode();
-                rendererTransition.Draw();
-            rendererTransition.EndMode();
+        // Render next state
+        rendererTransition.BeginMode();
+            nextState->second->Draw(rendererTransition, fixedStepAlpha);
+        rendererTransition.EndMode();
+    }
 
-        shaderMain->EndMode();
+    // Bake the main effects into both states (the snapshot already has them), so that
+    // the transition itself composes the final images, whatever the transition shader
+    {
+        RF_PROFILE_SCOPE(profiler, "Renderer::Draw");
+        if (live) BakeMainEffects(renderer);
+        BakeMainEffects(rendererTransition);
     }
 
     // Transition rendering
     window.BeginDrawing().ClearBackground();
+    {
+        RF_PROFILE_SCOPE(profiler, "Transition");
 
         if (shaderTransition != nullptr)
         {
@@ -106,22 +330,237 @@ void core::App::UpdateAndDrawTransition()
             }
         }
 
-        if (cursor.IsActive())
-        {
-            cursor.Draw(::GetMousePosition());
-        }
-
-    window.EndDrawing();
+        DrawScreenOverlays();
+    }
+    {
+        RF_PROFILE_SCOPE(profiler, "EndDrawing");
+        frameDrawEnd = GetTime();
+        window.EndDrawing();
+    }
 
     // Handle end transition
     if (valTransitionProgress >= 1.0f)
     {
         valTransitionProgress = 0.0f;
+        transitionSnapshotTaken = false;
         currentState->second->Exit();
         currentState = std::exchange(nextState, nullptr);
+        rendererTransition.Unload();
     }
 }
 
+void core::App::UpdateDynamicResolution()
+{
+    constexpr uint32_t interval = 15;   // Frames between two evaluations, lets the smoothed cost settle
+    constexpr float step = 0.05f;       // Granularity of the scale, so that the pooled targets are reused
+
+    const double budget = dynResBudget > 0.0 ? dynResBudget : frameBudget;
+    const double frameTime = GetFrameTime();
+
+    // The CPU time does not include the GPU work, a missed deadline does (swap stall)
+    const double cost = (frameTime > 1.1 * budget) ? frameTime : frameDrawEnd - frameStart;
+    dynResCost += 0.1 * (cost - dynResCost);
+
+    if (++dynResFrames < interval || OnTransition()) return;
+    dynResFrames = 0;
+
+    const float current = renderer.GetRenderScale();
+    float scale = current;
+
+    if (dynResCost > 0.95 * budget)
+    {
+        // The cost is mostly proportional to the number of pixels, i.e. to the square of the scale
+        scale *= static_cast<float>(std::sqrt(0.85 * budget / dynResCost));
+        scale = std::floor(scale / step + 0.001f) * step;
+    }
+    else if (dynResCost < 0.7 * budget)
+    {
+        scale = std::round(scale / step) * step + step;
+    }
+
+    scale = std::clamp(scale, dynResMinScale, dynResMaxScale);
+
+    if (std::abs(scale - current) > 0.001f)
+    {
+        renderer.SetRenderScale(scale);
+    }
+}
+
+void core::App::BakeMainEffects(Renderer& target)
+{
+    // Same rule as DrawMainRenderer(), the main shader would be replaced by the shaders of the chain
+    const bool chain = !postProcess.IsEmpty();
+    if (!chain && shaderMain == nullptr) return;
+
+    const ::RenderTexture &renderTexture = target.GetRenderTexture();
+    const float width = static_cast<float>(renderTexture.texture.width);
+    const float height = static_cast<float>(renderTexture.texture.height);
+
+    const Rectangle source = { 0, 0, width, -height };
+    const Rectangle full = { 0, 0, width, height };
+
+    ::RenderTexture baked = renderTargets.Acquire(renderTexture.texture.width, renderTexture.texture.height);
+    if (baked.id == 0) return;
+
+    BeginTextureMode(baked);
+        ClearBackground(BLANK);
+        if (chain)
+        {
+            postProcess.Apply(renderTexture.texture, source, full, WHITE, &renderTargets);
+        }
+        else
+        {
+            shaderMain->BeginMode();
+                DrawTexturePro(renderTexture.texture, source, full, { 0, 0 }, 0, WHITE);
+            shaderMain->EndMode();
+        }
+    EndTextureMode();
+
+    // Copied back as is, without blending with the unprocessed content
+    BeginTextureMode(renderTexture);
+        rlDisableColorBlend();
+        DrawTexturePro(baked.texture, source, full, { 0, 0 }, 0, WHITE);
+    EndTextureMode();
+    rlEnableColorBlend();
+
+    renderTargets.Release(baked);
+}
+
+void core::App::DrawMainRenderer()
+{
+    // The main shader would be replaced by the shaders of the chain
+    if (!postProcess.IsEmpty())
+    {
+        renderer.Draw(postProcess);
+        return;
+    }
+
+    if (shaderMain) shaderMain->BeginMode();
+        renderer.Draw();
+    if (shaderMain) shaderMain->EndMode();
+}
+
+void core::App::DrawScreenOverlays()
+{
+    if (cursor.IsActive())
+    {
+        cursor.Draw(::GetMousePosition());
+    }
+
+    if (memoryOverlay)
+    {
+        DrawMemoryOverlay();
+    }
+}
+
+void core::App::DrawMemoryOverlay() const
+{
+    constexpr int fontSize = 10;
+    constexpr int lineHeight = fontSize + 2;
+
+    // Right edges of the value columns, the default font is not monospaced
+    constexpr int colBytes = 140, colPeak = 220, colFrame = 276;
+
+    const MemoryReport report = MemoryTracker::GetReport();
+    const int count = static_cast<int>(MemoryTag::Count);
+
+    DrawRectangle(4, 4, 280, (count + 2) * lineHeight + 8, { 0, 0, 0, 160 });
+
+    if (!MemoryTracker::IsEnabled())
+    {
+        DrawText("Memory tracking disabled (RAYFLEX_MEMORY_TRACKING)", 8, 8, fontSize, RAYWHITE);
+        return;
+    }
+
+    const auto drawRight = [&](const char* text, int right, int y, Color color) {
+        DrawText(text, right - MeasureText(text, fontSize), y, fontSize, color);
+    };
+
+    const auto drawLine = [&](int line, const char* name, const MemoryStats& stats) {
+        const int y = 8 + line * lineHeight;
+        const Color color = line == 0 ? YELLOW : RAYWHITE;
+
+        DrawText(name, 8, y, fontSize, color);
+        drawRight(TextFormat("%.1f KB", stats.bytes / 1024.0), colBytes, y, color);
+        drawRight(TextFormat("%.1f KB", stats.peakBytes / 1024.0), colPeak, y, color);
+        drawRight(TextFormat("%zu", stats.frameAllocations), colFrame, y, color);
+    };
+
+    drawLine(0, "Total", report.total);
+
+    const int y = 8 + lineHeight;
+    drawRight("bytes", colBytes, y, GRAY);
+    drawRight("peak", colPeak, y, GRAY);
+    drawRight("allocs/f", colFrame, y, GRAY);
+
+    for (int i = 0; i < count; i++)
+    {
+        drawLine(i + 2, MemoryTracker::GetTagName(static_cast<MemoryTag>(i)), report.tags[i]);
+    }
+}
+
+void core::App::BeginFrame()
+{
+    frameStart = GetTime();
+    frameArena.NewFrame();
+    MemoryTracker::NewFrame();
+}
+
+void core::App::EndFrame(bool drawn)
+{
+    if (drawn)
+    {
+        RF_PROFILE_SCOPE(profiler, "FrameCapture::Capture");
+        frameCapture.Capture(renderer.GetRenderTexture());
+    }
+
+#   ifdef PLATFORM_WEB
+    {
+        RF_PROFILE_SCOPE(profiler, "MusicManager::Update");
+        musicManager.Update();
+    }
+#   endif
+
+    {
+        RF_PROFILE_SCOPE(profiler, "CommandQueue::Execute");
+        mainQueue.Execute(mainQueueBudget);
+    }
+
+    if (dynResEnabled)
+    {
+        UpdateDynamicResolution();
+    }
+
+    renderTargets.Collect();
+
+    // Evictions only happen between frames, pointers to assets are stable during a frame
+    assetManager.Collect();
+}
+
+void core::App::RunFrame()
+{
+    BeginFrame();
+
+    {
+        RF_PROFILE_SCOPE(profiler, "Frame");
+
+        if (nextState != nullptr) UpdateAndDrawTransition();
+        else if (pipelined) UpdateAndDrawPipelined();
+        else UpdateAndDraw();
+
+        EndFrame(true);
+    }
+
+#   ifndef PLATFORM_WEB
+    {
+        RF_PROFILE_SCOPE(profiler, "FrameLimiter::Wait");
+        frameLimiter.Wait();
+    }
+#   endif
+
+    profiler.EndFrame();
+}
+
 /* PUBLIC */
 
 core::App::App(const std::string& title, const Vector2& winSize, const Vector2& targetSize, bool keepAspectRatio, uint32_t flags, bool initAudio) : audio(true)
@@ -134,8 +573,42 @@ core::App::App(const std::string& title, int width, int height, uint32_t flags,
     Init(title, { static_cast<float>(width), static_cast<float>(height) }, { static_cast<float>(width), static_cast<float>(height) }, true, flags, initAudio);
 }
 
+core::App::~App()
+{
+    // Jobs may still reference assets or post to the main thread queue
+    jobSystem.Shutdown();
+}
+
+void core::App::SetFixedTimestep(bool enabled, uint32_t tickRate, int maxSteps)
+{
+    fixedStepEnabled = enabled;
+    fixedStepDelta = 1.0f / static_cast<float>(std::max(tickRate, 1u));
+    fixedStepMaxSteps = std::max(maxSteps, 1);
+    fixedStepAccumulator = 0.0f;
+    fixedStepAlpha = 1.0f;
+}
+
+void core::App::SetDynamicResolution(bool enabled, float budgetMs, float minScale, float maxScale)
+{
+    dynResEnabled = enabled;
+    dynResBudget = budgetMs * 0.001;
+    dynResMinScale = std::clamp(std::min(minScale, maxScale), 0.1f, 1.0f);
+    dynResMaxScale = std::clamp(std::max(minScale, maxScale), 0.1f, 1.0f);
+    dynResCost = 0.0;
+    dynResFrames = 0;
+
+    renderer.SetRenderScale(enabled ? dynResMaxScale : 1.0f);
+}
+
 void core::App::SetState(const std::string& stateName)
 {
+    // Called from a pipelined Update(), the state is changed by the main thread
+    if (!mainQueue.IsOwnerThread())
+    {
+        mainQueue.Post([this, stateName]() { SetState(stateName); });
+        return;
+    }
+
     if (stateName != currentState->first)
     {
         currentState->second->Exit();
@@ -144,8 +617,15 @@ void core::App::SetState(const std::string& stateName)
     }
 }
 
-void core::App::Transition(const std::string& stateName, float duration, raylib::Shader* shader)
+void core::App::Transition(const std::string& stateName, float duration, raylib::Shader* shader, TransitionMode mode)
 {
+    // Called from a pipelined Update(), the transition is started by the main thread
+    if (!mainQueue.IsOwnerThread())
+    {
+        mainQueue.Post([=]() { Transition(stateName, duration, shader, mode); });
+        return;
+    }
+
     if (nextState != nullptr) return;
 
     if (shader != nullptr && shader != shaderTransition)
@@ -155,7 +635,12 @@ void core::App::Transition(const std::string& stateName, float duration, raylib:
         locTransitionNextTexture = shader->GetLocation("textureN");
     }
 
+    rendererTransition.SetRenderScale(renderer.GetRenderScale());
+    rendererTransition.Load(renderer.GetSize(), renderer.IsRatioKept());
+
     valTransitionInvDuration = 1.0f / duration;
+    transitionMode = mode;
+    transitionSnapshotTaken = false;
     nextState = &(*states.find(stateName));
     nextState->second->Enter();
 }
@@ -166,13 +651,15 @@ int core::App::Run(const std::string& firstState, uint32_t targetFPS)
     currentState->second->Enter();
 
     running = true;
+    frameBudget = 1.0 / static_cast<double>(targetFPS > 0 ? targetFPS : 60);
 
 #   ifdef PLATFORM_WEB
         emscripten_set_main_loop_arg(
             UpdateAndDrawLoopCallback, this,
             targetFPS, 1);
 #   else
-        window.SetTargetFPS(targetFPS);
+        frameLimiter.SetTargetFPS(targetFPS);
+
         while (running && !window.ShouldClose())
         {
             if (window.IsResized())
@@ -180,9 +667,7 @@ int core::App::Run(const std::string& firstState, uint32_t targetFPS)
                 rendererTransition.Update();
                 renderer.Update();
             }
-            if (nextState == nullptr) UpdateAndDraw();
-            else UpdateAndDrawTransition();
-            musicManager.Update();
+            RunFrame();
         }
 #   endif
 
@@ -192,6 +677,125 @@ int core::App::Run(const std::string& firstState, uint32_t targetFPS)
     return retCode;
 }
 
+core::BenchmarkReport core::App::Benchmark(const std::string& stateName, uint32_t frames, float dt, BenchmarkMode mode)
+{
+    BenchmarkReport report;
+    report.state = stateName;
+    report.dt = dt;
+
+    auto it = states.find(stateName);
+    if (it == states.end())
+    {
+        TraceLog(LOG_WARNING, "App::Benchmark() -> State [%s] was not found", stateName.c_str());
+        return report;
+    }
+
+    if (headless && mode != BenchmarkMode::NoDraw)
+    {
+        TraceLog(LOG_WARNING, "App::Benchmark() -> App is headless, falling back to the no draw mode");
+        mode = BenchmarkMode::NoDraw;
+    }
+
+    report.mode = mode;
+
+    // The benchmarked state becomes the current one during the run (see GetRenderer)
+    auto *prevState = std::exchange(currentState, &(*it));
+    State *state = currentState->second.get();
+
+    const bool profilerWasEnabled = profiler.IsEnabled();
+    profiler.SetEnabled(true);
+    profiler.ResetStats(); // Discards the events and statistics recorded before the run
+
+    const float prevFixedStepAccumulator = std::exchange(fixedStepAccumulator, 0.0f);
+    const bool prevDynResEnabled = std::exchange(dynResEnabled, false); // The render scale stays fixed during the run
+
+    std::vector<float> frameTimes;
+    frameTimes.reserve(frames);
+
+    // The profiler history only keeps the last frames, the phases are aggregated over the whole run
+    std::unordered_map<std::string_view, std::vector<float>> phaseTimes;
+
+    state->Enter();
+
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        const int64_t start = profiler.Now();
+        BeginFrame();
+
+        {
+            RF_PROFILE_SCOPE(profiler, "Frame");
+
+            {
+                RF_PROFILE_SCOPE(profiler, "State::FixedUpdate");
+                for (int steps = ConsumeFixedSteps(dt); steps > 0; steps--)
+                {
+                    state->FixedUpdate(fixedStepDelta);
+                }
+            }
+
+            {
+                RF_PROFILE_SCOPE(profiler, "State::Update");
+                state->Update(dt);
+                state->Sync();
+            }
+
+            if (mode != BenchmarkMode::NoDraw)
+            {
+                RF_PROFILE_SCOPE(profiler, "State::Draw");
+                renderer.BeginMode();
+                    state->Draw(renderer, fixedStepAlpha);
+                renderer.EndMode();
+            }
+
+            if (mode == BenchmarkMode::Present)
+            {
+                window.BeginDrawing().ClearBackground();
+                {
+                    RF_PROFILE_SCOPE(profiler, "Renderer::Draw");
+                    DrawMainRenderer();
+                }
+                {
+                    RF_PROFILE_SCOPE(profiler, "EndDrawing");
+                    window.EndDrawing();
+                }
+            }
+
+            EndFrame(mode != BenchmarkMode::NoDraw);
+        }
+
+        frameTimes.push_back(static_cast<float>(profiler.Now() - start) * 1e-6f);
+        profiler.EndFrame();
+
+        for (const auto& [name, time] : profiler.GetLastFrame())
+        {
+            phaseTimes[name].push_back(time);
+        }
+    }
+
+    state->Exit();
+
+    currentState = prevState;
+    fixedStepAccumulator = prevFixedStepAccumulator;
+    dynResEnabled = prevDynResEnabled;
+
+    report.ComputeFrameStats(std::move(frameTimes));
+
+    for (auto& [name, times] : phaseTimes)
+    {
+        report.AddPhase(std::string(name), std::move(times));
+    }
+
+    std::sort(report.phases.begin(), report.phases.end(),
+        [](const auto& a, const auto& b) { return a.name < b.name; });
+
+    profiler.SetEnabled(profilerWasEnabled);
+
+    // The benchmark frames are not paced, the deadlines restart from now
+    frameLimiter.Restart();
+
+    return report;
+}
+
 const core::Renderer& core::App::GetRenderer(const State* state) const
 {
     if (state == currentState->second.get()) return renderer;
@@ -229,6 +833,9 @@ void core::App::SetResolution(const Vector2& size, bool fitWindowSize)
     rendererTransition.Resize(size);
     renderer.Resize(size);
 
+    // A resize clears the targets, the snapshot of an ongoing transition is captured again
+    transitionSnapshotTaken = false;
+
     if (fitWindowSize)
     {
         window.SetSize(size);
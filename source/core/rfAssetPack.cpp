@@ -0,0 +1,402 @@
+#if defined(_WIN32)
+// Excludes the parts of the Windows API conflicting with raylib
+#   define WIN32_LEAN_AND_MEAN
+#   define NOGDI
+#   define NOUSER
+#   include <windows.h>
+#else
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+#include "core/rfAssetPack.hpp"
+#include "core/rfCooked.hpp"
+#include <algorithm>
+#include <cstring>
+#include <climits>
+#include <fstream>
+#include <utility>
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    static_assert(sizeof(core::AssetPack::Header) == 32, "Unexpected AssetPack::Header layout");
+    static_assert(sizeof(core::AssetPack::Entry) == 48, "Unexpected AssetPack::Entry layout");
+
+    uint64_t AlignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    /**
+     * @brief Maps a whole file read-only, returns the base address or nullptr on failure.
+     */
+    const unsigned char* MapFile(const std::string& fileName, std::size_t& size, void*& mapping)
+    {
+#   if defined(_WIN32)
+
+        HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return nullptr;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        HANDLE handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);  // The mapping keeps a reference to the file
+        if (!handle) return nullptr;
+
+        void *view = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            CloseHandle(handle);
+            return nullptr;
+        }
+
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        mapping = handle;
+
+        return static_cast<const unsigned char*>(view);
+
+#   else
+
+        const int fd = open(fileName.c_str(), O_RDONLY);
+        if (fd < 0) return nullptr;
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        void *view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);  // The mapping keeps a reference to the file
+        if (view == MAP_FAILED) return nullptr;
+
+        size = static_cast<std::size_t>(st.st_size);
+        mapping = nullptr;
+
+        return static_cast<const unsigned char*>(view);
+
+#   endif
+    }
+
+    void UnmapFile(const unsigned char* base, std::size_t size, void* mapping)
+    {
+#   if defined(_WIN32)
+        (void)size;
+        UnmapViewOfFile(base);
+        CloseHandle(static_cast<HANDLE>(mapping));
+#   else
+        (void)mapping;
+        munmap(const_cast<unsigned char*>(base), size);
+#   endif
+    }
+
+}
+
+/* PUBLIC */
+
+core::AssetPack::AssetPack(AssetPack&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+core::AssetPack& core::AssetPack::operator=(AssetPack&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+
+        base = std::exchange(other.base, nullptr);
+        size = std::exchange(other.size, 0);
+        header = std::exchange(other.header, nullptr);
+        toc = std::exchange(other.toc, nullptr);
+        names = std::exchange(other.names, nullptr);
+        mapping = std::exchange(other.mapping, nullptr);
+    }
+    return *this;
+}
+
+bool core::AssetPack::Open(const std::string& fileName)
+{
+    Close();
+
+    base = MapFile(fileName, size, mapping);
+
+    if (!base)
+    {
+        TraceLog(LOG_WARNING, "AssetPack::Open() -> Unable to map [%s]", fileName.c_str());
+        return false;
+    }
+
+    // Validation of the header and of the table of contents bounds,
+    // the data itself is only touched when the entries are loaded
+    const Header *h = reinterpret_cast<const Header*>(base);
+
+    bool valid = size >= sizeof(Header) && h->magic == Magic && h->version == Version
+        && h->tocOffset % alignof(Entry) == 0 && h->tocOffset <= size
+        && h->entryCount <= (size - h->tocOffset) / sizeof(Entry)
+        && h->namesOffset <= size;
+
+    if (valid)
+    {
+        const Entry *entries = reinterpret_cast<const Entry*>(base + h->tocOffset);
+        const char *table = reinterpret_cast<const char*>(base + h->namesOffset);
+
+        for (uint32_t i = 0; valid && i < h->entryCount; i++)
+        {
+            const Entry &entry = entries[i];
+
+            valid = entry.offset <= size && entry.size <= size - entry.offset
+                && entry.nameOffset + static_cast<uint64_t>(entry.nameLength) < size - h->namesOffset
+                && (i == 0 || entries[i - 1].hash < entry.hash);
+
+            // Unknown compression methods are not guessed, and the sizes are given to raylib as int
+            valid = valid && (entry.compression == Compression::None || entry.compression == Compression::Deflate)
+                && entry.size <= INT_MAX && entry.rawSize <= INT_MAX;
+
+            // The names are returned as C strings, they must end exactly at their terminator
+            valid = valid && table[entry.nameOffset + entry.nameLength] == '\0'
+                && std::memchr(table + entry.nameOffset, '\0', entry.nameLength) == nullptr;
+        }
+    }
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "AssetPack::Open() -> [%s] is not a valid asset pack (version %i)", fileName.c_str(), Version);
+        Close();
+        return false;
+    }
+
+    header = h;
+    toc = reinterpret_cast<const Entry*>(base + header->tocOffset);
+    names = reinterpret_cast<const char*>(base + header->namesOffset);
+
+    TraceLog(LOG_INFO, "AssetPack::Open() -> [%s] mapped with %i entries", fileName.c_str(), header->entryCount);
+
+    return true;
+}
+
+void core::AssetPack::Close()
+{
+    if (base) UnmapFile(base, size, mapping);
+
+    base = nullptr, size = 0;
+    header = nullptr, toc = nullptr;
+    names = nullptr, mapping = nullptr;
+}
+
+const core::AssetPack::Entry* core::AssetPack::Find(AssetId id) const
+{
+    const Entry *first = begin(), *last = end();
+
+    const Entry *it = std::lower_bound(first, last, id.GetValue(),
+        [](const Entry& entry, uint64_t hash) { return entry.hash < hash; });
+
+    return (it != last && it->hash == id.GetValue()) ? it : nullptr;
+}
+
+const char* core::AssetPack::GetFileType(const Entry& entry) const
+{
+    const char *ext = GetFileExtension(GetName(entry));
+    return ext ? ext : "";
+}
+
+core::AssetPack::Blob core::AssetPack::Load(const Entry& entry) const
+{
+    const unsigned char *data = base + entry.offset;
+
+    if (entry.compression == Compression::None)
+    {
+        return Blob(data, entry.size);
+    }
+
+    int rawSize = 0;
+    unsigned char *raw = DecompressData(data, static_cast<int>(entry.size), &rawSize);
+
+    if (!raw || static_cast<uint64_t>(rawSize) != entry.rawSize)
+    {
+        TraceLog(LOG_WARNING, "AssetPack::Load() -> Failed to decompress entry [%s]", GetName(entry));
+        MemFree(raw);
+        return Blob();
+    }
+
+    return Blob(raw, rawSize, MemFree);
+}
+
+::Image core::AssetPack::LoadImage(AssetId id) const
+{
+    const Entry *entry = Find(id);
+    if (!entry) return ::Image{};
+
+    Blob blob = Load(*entry);
+    if (!blob) return ::Image{};
+
+    if (IsCookedTexture(blob.GetData(), blob.GetSize()))
+    {
+        return LoadCookedImage(blob.GetData(), blob.GetSize());
+    }
+
+    return LoadImageFromMemory(GetFileType(*entry), blob.GetData(), blob.GetIntSize());
+}
+
+::Texture core::AssetPack::LoadTexture(AssetId id) const
+{
+    const Entry *entry = Find(id);
+    if (!entry) return ::Texture{};
+
+    Blob blob = Load(*entry);
+    if (!blob) return ::Texture{};
+
+    if (IsCookedTexture(blob.GetData(), blob.GetSize()))
+    {
+        return LoadCookedTexture(blob.GetData(), blob.GetSize());
+    }
+
+    ::Image image = LoadImageFromMemory(GetFileType(*entry), blob.GetData(), blob.GetIntSize());
+    ::Texture texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    return texture;
+}
+
+::Model core::AssetPack::LoadModel(AssetId id, bool upload) const
+{
+    Blob blob = Load(id);
+    if (!blob) return ::Model{};
+
+    return LoadCookedModel(blob.GetData(), blob.GetSize(), upload);
+}
+
+::Wave core::AssetPack::LoadWave(AssetId id) const
+{
+    const Entry *entry = Find(id);
+    if (!entry) return ::Wave{};
+
+    Blob blob = Load(*entry);
+    if (!blob) return ::Wave{};
+
+    return LoadWaveFromMemory(GetFileType(*entry), blob.GetData(), blob.GetIntSize());
+}
+
+::Music core::AssetPack::LoadMusic(AssetId id) const
+{
+    const Entry *entry = Find(id);
+    if (!entry) return ::Music{};
+
+    if (entry->compression != Compression::None)
+    {
+        TraceLog(LOG_WARNING, "AssetPack::LoadMusic() -> Entry [%s] must be stored uncompressed to be streamed", GetName(*entry));
+        return ::Music{};
+    }
+
+    return LoadMusicStreamFromMemory(GetFileType(*entry), base + entry->offset, static_cast<int>(entry->size));
+}
+
+bool core::AssetPack::Build(const std::string& fileName, std::vector<Source> sources)
+{
+    std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) {
+        return AssetId::Hash(a.name) < AssetId::Hash(b.name);
+    });
+
+    const uint32_t count = static_cast<uint32_t>(sources.size());
+
+    std::vector<Entry> entries(count);
+    std::string nameTable;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Source &source = sources[i];
+        Entry &entry = entries[i];
+
+        entry = Entry{};
+        entry.hash = AssetId::Hash(source.name);
+        entry.rawSize = source.data.size();
+
+        if (i > 0 && entry.hash == entries[i - 1].hash)
+        {
+            TraceLog(LOG_WARNING, "AssetPack::Build() -> Entries [%s] and [%s] have the same hash",
+                sources[i - 1].name.c_str(), source.name.c_str());
+            return false;
+        }
+
+        if (source.data.size() > INT_MAX)
+        {
+            TraceLog(LOG_WARNING, "AssetPack::Build() -> Entry [%s] is larger than 2 GB", source.name.c_str());
+            return false;
+        }
+
+        // Replaces the data by its compressed version only if it is smaller
+        if (source.compress && !source.data.empty())
+        {
+            int compSize = 0;
+            unsigned char *comp = CompressData(source.data.data(), static_cast<int>(source.data.size()), &compSize);
+
+            if (comp && static_cast<std::size_t>(compSize) < source.data.size())
+            {
+                source.data.assign(comp, comp + compSize);
+                entry.compression = Compression::Deflate;
+            }
+
+            MemFree(comp);
+        }
+
+        entry.size = source.data.size();
+        entry.nameOffset = static_cast<uint32_t>(nameTable.size());
+        entry.nameLength = static_cast<uint32_t>(source.name.size());
+
+        nameTable.append(source.name);
+        nameTable.push_back('\0');
+    }
+
+    // Layout: header, table of contents, table of names, then the aligned data
+    Header header{};
+    header.magic = Magic;
+    header.version = Version;
+    header.entryCount = count;
+    header.tocOffset = sizeof(Header);
+    header.namesOffset = header.tocOffset + count * sizeof(Entry);
+
+    uint64_t offset = header.namesOffset + nameTable.size();
+
+    for (Entry& entry : entries)
+    {
+        entry.offset = offset = AlignUp(offset, Alignment);
+        offset += entry.size;
+    }
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        TraceLog(LOG_WARNING, "AssetPack::Build() -> Unable to open [%s] for writing", fileName.c_str());
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry));
+    file.write(nameTable.data(), nameTable.size());
+
+    uint64_t position = header.namesOffset + nameTable.size();
+    const char padding[Alignment] = {};
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        file.write(padding, entries[i].offset - position);
+        file.write(reinterpret_cast<const char*>(sources[i].data.data()), sources[i].data.size());
+        position = entries[i].offset + entries[i].size;
+    }
+
+    return !file.fail();
+}
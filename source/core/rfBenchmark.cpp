@@ -0,0 +1,133 @@
+#include "core/rfBenchmark.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    float Percentile(const std::vector<float>& sorted, float p)
+    {
+        const size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5f);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    void WriteEscaped(std::ostream& json, const std::string& str)
+    {
+        constexpr char hex[] = "0123456789abcdef";
+
+        for (char c : str)
+        {
+            const auto u = static_cast<unsigned char>(c);
+
+            if (c == '"' || c == '\\') json << '\\' << c;
+            else if (u < 0x20) json << "\\u00" << hex[u >> 4] << hex[u & 0xF];
+            else json << c;
+        }
+    }
+
+    const char* ModeName(core::BenchmarkMode mode)
+    {
+        switch (mode)
+        {
+            case core::BenchmarkMode::Present:      return "present";
+            case core::BenchmarkMode::Offscreen:    return "offscreen";
+            case core::BenchmarkMode::NoDraw:       return "nodraw";
+        }
+        return "unknown";
+    }
+
+}
+
+/* PUBLIC */
+
+void core::BenchmarkReport::ComputeFrameStats(std::vector<float> frameTimes)
+{
+    frames = static_cast<uint32_t>(frameTimes.size());
+    if (frameTimes.empty()) return;
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+
+    total = 0;
+    for (float t : frameTimes) total += t;
+
+    min = frameTimes.front();
+    max = frameTimes.back();
+    avg = total / frameTimes.size();
+    p50 = Percentile(frameTimes, 0.50f);
+    p90 = Percentile(frameTimes, 0.90f);
+    p99 = Percentile(frameTimes, 0.99f);
+}
+
+void core::BenchmarkReport::AddPhase(std::string name, std::vector<float> times)
+{
+    Phase phase{ std::move(name), {} };
+
+    if (!times.empty())
+    {
+        phase.stats.last = times.back();
+        std::sort(times.begin(), times.end());
+
+        float sum = 0;
+        for (float t : times) sum += t;
+
+        phase.stats.min = times.front();
+        phase.stats.avg = sum / times.size();
+        phase.stats.p99 = Percentile(times, 0.99f);
+        phase.stats.samples = static_cast<uint32_t>(times.size());
+    }
+
+    phases.push_back(std::move(phase));
+}
+
+std::string core::BenchmarkReport::ToJSON() const
+{
+    std::ostringstream json;
+
+    json << "{\n"
+         << "  \"state\": \"";
+
+    WriteEscaped(json, state);
+
+    json << "\",\n"
+         << "  \"mode\": \"" << ModeName(mode) << "\",\n"
+         << "  \"frames\": " << frames << ",\n"
+         << "  \"dt\": " << dt << ",\n"
+         << "  \"frameTime\": { "
+         << "\"total\": " << total << ", "
+         << "\"min\": " << min << ", "
+         << "\"avg\": " << avg << ", "
+         << "\"p50\": " << p50 << ", "
+         << "\"p90\": " << p90 << ", "
+         << "\"p99\": " << p99 << ", "
+         << "\"max\": " << max << " },\n"
+         << "  \"phases\": {";
+
+    for (size_t i = 0; i < phases.size(); i++)
+    {
+        const Phase &phase = phases[i];
+        json << (i == 0 ? "\n" : ",\n") << "    \"";
+        WriteEscaped(json, phase.name);
+        json << "\": { "
+             << "\"min\": " << phase.stats.min << ", "
+             << "\"avg\": " << phase.stats.avg << ", "
+             << "\"p99\": " << phase.stats.p99 << ", "
+             << "\"samples\": " << phase.stats.samples << " }";
+    }
+
+    json << (phases.empty() ? "}\n" : "\n  }\n") << "}\n";
+
+    return json.str();
+}
+
+bool core::BenchmarkReport::Save(const std::string& fileName) const
+{
+    std::ofstream file(fileName);
+    if (!file.is_open()) return false;
+
+    file << ToJSON();
+    return !file.fail();
+}
@@ -0,0 +1,369 @@
+#include "core/rfCooked.hpp"
+#include "core/rfAssetTraits.hpp"
+#include <raymath.h>
+#include <rlgl.h>
+#include <algorithm>
+#include <iterator>
+#include <cstring>
+#include <cfloat>
+#include <climits>
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    constexpr std::size_t Pad4(std::size_t size)
+    {
+        return (size + 3) & ~static_cast<std::size_t>(3);
+    }
+
+    /**
+     * @brief Describes an attribute array of a mesh for the serialization.
+     */
+    struct MeshArray
+    {
+        uint32_t flag;          ///< Attribute flag, zero for the positions which are always present.
+        std::size_t elemSize;   ///< Size of an element (per vertex or per triangle).
+        bool perTriangle;       ///< Flag indicating whether there is one element per triangle rather than per vertex.
+    };
+
+    constexpr MeshArray meshArrays[] = {
+        { 0,                                    3 * sizeof(float),          false },
+        { core::CookedMeshHeader::Texcoords,    2 * sizeof(float),          false },
+        { core::CookedMeshHeader::Texcoords2,   2 * sizeof(float),          false },
+        { core::CookedMeshHeader::Normals,      3 * sizeof(float),          false },
+        { core::CookedMeshHeader::Tangents,     4 * sizeof(float),          false },
+        { core::CookedMeshHeader::Colors,       4 * sizeof(unsigned char),  false },
+        { core::CookedMeshHeader::Indices,      3 * sizeof(unsigned short), true  }
+    };
+
+    void FreeMeshArrays(::Mesh& mesh)
+    {
+        MemFree(mesh.vertices), MemFree(mesh.texcoords);
+        MemFree(mesh.texcoords2), MemFree(mesh.normals);
+        MemFree(mesh.tangents), MemFree(mesh.colors);
+        MemFree(mesh.indices);
+    }
+
+    void GetMeshArrays(const ::Mesh& mesh, const void** pointers)
+    {
+        pointers[0] = mesh.vertices, pointers[1] = mesh.texcoords;
+        pointers[2] = mesh.texcoords2, pointers[3] = mesh.normals;
+        pointers[4] = mesh.tangents, pointers[5] = mesh.colors;
+        pointers[6] = mesh.indices;
+    }
+
+    void SetMeshArrays(::Mesh& mesh, void** pointers)
+    {
+        mesh.vertices = static_cast<float*>(pointers[0]);
+        mesh.texcoords = static_cast<float*>(pointers[1]);
+        mesh.texcoords2 = static_cast<float*>(pointers[2]);
+        mesh.normals = static_cast<float*>(pointers[3]);
+        mesh.tangents = static_cast<float*>(pointers[4]);
+        mesh.colors = static_cast<unsigned char*>(pointers[5]);
+        mesh.indices = static_cast<unsigned short*>(pointers[6]);
+    }
+
+    std::size_t MeshArraySize(const MeshArray& array, const core::CookedMeshHeader& header)
+    {
+        return array.elemSize * (array.perTriangle ? header.triangleCount : header.vertexCount);
+    }
+
+    ::BoundingBox ComputeBounds(const ::Mesh& mesh)
+    {
+        ::BoundingBox bounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+        if (!mesh.vertices || mesh.vertexCount == 0) return ::BoundingBox{};
+
+        for (int i = 0; i < mesh.vertexCount; i++)
+        {
+            const float *v = mesh.vertices + 3 * i;
+            bounds.min = { std::min(bounds.min.x, v[0]), std::min(bounds.min.y, v[1]), std::min(bounds.min.z, v[2]) };
+            bounds.max = { std::max(bounds.max.x, v[0]), std::max(bounds.max.y, v[1]), std::max(bounds.max.z, v[2]) };
+        }
+
+        return bounds;
+    }
+
+    ::BoundingBox MergeBounds(const ::BoundingBox& a, const ::BoundingBox& b)
+    {
+        return {
+            { std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z) },
+            { std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z) }
+        };
+    }
+
+    template <typename T>
+    void Append(std::vector<unsigned char>& out, const T& value)
+    {
+        const unsigned char *bytes = reinterpret_cast<const unsigned char*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    const core::CookedTextureHeader* GetTextureHeader(const unsigned char* data, std::size_t size)
+    {
+        if (!data || size < sizeof(core::CookedTextureHeader)) return nullptr;
+
+        const auto *header = reinterpret_cast<const core::CookedTextureHeader*>(data);
+
+        if (header->magic != core::CookedTextureHeader::Magic
+         || header->version != core::CookedTextureHeader::Version
+         || header->dataSize > size - sizeof(core::CookedTextureHeader))
+        {
+            return nullptr;
+        }
+
+        // The levels are read from the blob according to the header, their size must match the data exactly.
+        // raylib computes the size of a level as an int of bits (up to 128 per pixel), larger levels are rejected.
+        const bool validFormat = header->format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            && header->format <= PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA;
+
+        const bool validSize = header->width > 0 && header->height > 0
+            && static_cast<int64_t>(header->width) * header->height <= INT_MAX / 128
+            && header->mipmaps >= 1 && header->mipmaps <= 32;
+
+        if (!validFormat || !validSize || header->dataSize != core::GetPixelDataSizeMipmaps(
+            header->width, header->height, header->mipmaps, header->format))
+        {
+            return nullptr;
+        }
+
+        return header;
+    }
+
+}
+
+/* PUBLIC */
+
+std::vector<unsigned char> core::CookImage(const ::Image& image)
+{
+    std::vector<unsigned char> out;
+    if (!image.data) return out;
+
+    CookedTextureHeader header{};
+    header.magic = CookedTextureHeader::Magic;
+    header.version = CookedTextureHeader::Version;
+    header.width = image.width;
+    header.height = image.height;
+    header.mipmaps = image.mipmaps > 0 ? image.mipmaps : 1;
+    header.format = image.format;
+    header.dataSize = GetPixelDataSizeMipmaps(image.width, image.height, header.mipmaps, image.format);
+
+    out.reserve(sizeof(header) + header.dataSize);
+    Append(out, header);
+
+    const unsigned char *pixels = static_cast<const unsigned char*>(image.data);
+    out.insert(out.end(), pixels, pixels + header.dataSize);
+
+    return out;
+}
+
+std::vector<unsigned char> core::CookModel(const ::Model& model)
+{
+    std::vector<unsigned char> out;
+
+    CookedModelHeader header{};
+    header.magic = CookedModelHeader::Magic;
+    header.version = CookedModelHeader::Version;
+    header.meshCount = static_cast<uint32_t>(model.meshCount);
+
+    std::vector<CookedMeshHeader> meshHeaders(model.meshCount);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        const ::Mesh &mesh = model.meshes[i];
+        const void *pointers[7];
+        GetMeshArrays(mesh, pointers);
+
+        CookedMeshHeader &meshHeader = meshHeaders[i];
+        meshHeader = CookedMeshHeader{};
+        if (!mesh.vertices) continue;   // Cooked as an empty mesh
+
+        meshHeader.vertexCount = mesh.vertexCount;
+        meshHeader.triangleCount = mesh.triangleCount;
+        meshHeader.bounds = ComputeBounds(mesh);
+
+        for (std::size_t j = 1; j < std::size(meshArrays); j++)
+        {
+            if (pointers[j]) meshHeader.attributes |= meshArrays[j].flag;
+        }
+
+        header.bounds = (i == 0) ? meshHeader.bounds : MergeBounds(header.bounds, meshHeader.bounds);
+    }
+
+    Append(out, header);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        const ::Mesh &mesh = model.meshes[i];
+        const void *pointers[7];
+        GetMeshArrays(mesh, pointers);
+
+        const CookedMeshHeader &meshHeader = meshHeaders[i];
+        Append(out, meshHeader);
+
+        for (std::size_t j = 0; j < std::size(meshArrays); j++)
+        {
+            if (j > 0 && !(meshHeader.attributes & meshArrays[j].flag)) continue;
+
+            const std::size_t size = MeshArraySize(meshArrays[j], meshHeader);
+            const unsigned char *bytes = static_cast<const unsigned char*>(pointers[j]);
+
+            out.insert(out.end(), bytes, bytes + size);
+            out.resize(out.size() + Pad4(size) - size, 0);
+        }
+    }
+
+    return out;
+}
+
+bool core::IsCookedTexture(const unsigned char* data, std::size_t size)
+{
+    return GetTextureHeader(data, size) != nullptr;
+}
+
+bool core::IsCookedModel(const unsigned char* data, std::size_t size)
+{
+    if (!data || size < sizeof(CookedModelHeader)) return false;
+    const auto *header = reinterpret_cast<const CookedModelHeader*>(data);
+    return header->magic == CookedModelHeader::Magic && header->version == CookedModelHeader::Version;
+}
+
+::Image core::LoadCookedImage(const unsigned char* data, std::size_t size)
+{
+    const CookedTextureHeader *header = GetTextureHeader(data, size);
+
+    if (!header)
+    {
+        TraceLog(LOG_WARNING, "LoadCookedImage() -> Invalid cooked texture data");
+        return ::Image{};
+    }
+
+    ::Image image{};
+    image.data = MemAlloc(static_cast<unsigned int>(header->dataSize));
+    std::memcpy(image.data, data + sizeof(CookedTextureHeader), header->dataSize);
+    image.width = header->width, image.height = header->height;
+    image.mipmaps = header->mipmaps, image.format = header->format;
+
+    return image;
+}
+
+::Texture core::LoadCookedTexture(const unsigned char* data, std::size_t size)
+{
+    const CookedTextureHeader *header = GetTextureHeader(data, size);
+
+    if (!header)
+    {
+        TraceLog(LOG_WARNING, "LoadCookedTexture() -> Invalid cooked texture data");
+        return ::Texture{};
+    }
+
+    ::Texture texture{};
+    texture.id = rlLoadTexture(data + sizeof(CookedTextureHeader), header->width, header->height, header->format, header->mipmaps);
+    texture.width = header->width, texture.height = header->height;
+    texture.mipmaps = header->mipmaps, texture.format = header->format;
+
+    return texture;
+}
+
+::Model core::LoadCookedModel(const unsigned char* data, std::size_t size, bool upload)
+{
+    ::Model model{};
+
+    if (!IsCookedModel(data, size))
+    {
+        TraceLog(LOG_WARNING, "LoadCookedModel() -> Invalid cooked model data");
+        return model;
+    }
+
+    const auto *header = reinterpret_cast<const CookedModelHeader*>(data);
+    const unsigned char *cursor = data + sizeof(CookedModelHeader), *end = data + size;
+
+    std::vector<::Mesh> meshes;
+    meshes.reserve(header->meshCount);
+
+    bool valid = true;
+
+    for (uint32_t i = 0; valid && i < header->meshCount; i++)
+    {
+        if (static_cast<std::size_t>(end - cursor) < sizeof(CookedMeshHeader))
+        {
+            valid = false;
+            break;
+        }
+
+        CookedMeshHeader meshHeader;
+        std::memcpy(&meshHeader, cursor, sizeof(meshHeader));
+        cursor += sizeof(meshHeader);
+
+        ::Mesh mesh{};
+        mesh.vertexCount = meshHeader.vertexCount;
+        mesh.triangleCount = meshHeader.triangleCount;
+
+        void *pointers[7] = {};
+
+        for (std::size_t j = 0; j < std::size(meshArrays); j++)
+        {
+            if (j > 0 && !(meshHeader.attributes & meshArrays[j].flag)) continue;
+
+            const std::size_t arraySize = MeshArraySize(meshArrays[j], meshHeader);
+
+            if (static_cast<std::size_t>(end - cursor) < Pad4(arraySize))
+            {
+                valid = false;
+                break;
+            }
+
+            pointers[j] = MemAlloc(static_cast<unsigned int>(arraySize));
+            std::memcpy(pointers[j], cursor, arraySize);
+            cursor += Pad4(arraySize);
+        }
+
+        // The indices are uploaded as is, they must reference existing vertices
+        const auto *indices = static_cast<const unsigned short*>(pointers[6]);
+
+        for (int32_t k = 0; valid && indices && k < 3 * meshHeader.triangleCount; k++)
+        {
+            valid = indices[k] < meshHeader.vertexCount;
+        }
+
+        // Pushed even if invalid so that the arrays already allocated are released below
+        SetMeshArrays(mesh, pointers);
+        meshes.push_back(mesh);
+    }
+
+    if (!valid)
+    {
+        TraceLog(LOG_WARNING, "LoadCookedModel() -> Truncated or invalid cooked model data");
+
+        // Only the CPU arrays exist at this point, UnloadMesh() would require the GL context
+        for (::Mesh& mesh : meshes) FreeMeshArrays(mesh);
+
+        return model;
+    }
+
+    model.transform = MatrixIdentity();
+
+    model.meshCount = static_cast<int>(meshes.size());
+    model.meshes = static_cast<::Mesh*>(MemAlloc(static_cast<unsigned int>(meshes.size() * sizeof(::Mesh))));
+    std::memcpy(model.meshes, meshes.data(), meshes.size() * sizeof(::Mesh));
+
+    model.materialCount = 1;
+    model.materials = static_cast<::Material*>(MemAlloc(sizeof(::Material)));
+    model.materials[0] = LoadMaterialDefault();
+    model.meshMaterial = static_cast<int*>(MemAlloc(static_cast<unsigned int>(meshes.size() * sizeof(int))));
+
+    if (upload)
+    {
+        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+    }
+
+    return model;
+}
+
+::BoundingBox core::GetCookedModelBounds(const unsigned char* data, std::size_t size)
+{
+    if (!IsCookedModel(data, size)) return ::BoundingBox{};
+    return reinterpret_cast<const CookedModelHeader*>(data)->bounds;
+}
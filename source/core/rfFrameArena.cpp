@@ -0,0 +1,71 @@
+#include "core/rfFrameArena.hpp"
+#include <algorithm>
+
+using namespace rf;
+
+/* PRIVATE */
+
+void* core::FrameArena::AllocateOverflow(Buffer& buffer, std::size_t size, std::size_t alignment)
+{
+    // Over-allocated to align the block by hand, so that it can be freed with the plain operator delete
+    char *block = static_cast<char*>(::operator new(size + alignment - 1));
+    buffer.overflow.fetch_add(size, std::memory_order_relaxed);
+
+    {
+        std::scoped_lock lock(overflowMutex);
+        buffer.overflowBlocks.push_back(block);
+    }
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(block);
+    return block + (((address + alignment - 1) & ~(alignment - 1)) - address);
+}
+
+std::size_t core::FrameArena::GetUsed(const Buffer& buffer)
+{
+    return buffer.offset.load(std::memory_order_relaxed) + buffer.overflow.load(std::memory_order_relaxed);
+}
+
+/* PUBLIC */
+
+core::FrameArena::FrameArena(std::size_t capacity)
+{
+    for (Buffer& buffer : buffers)
+    {
+        buffer.data.reset(new char[capacity]);
+        buffer.capacity = capacity;
+    }
+}
+
+core::FrameArena::~FrameArena()
+{
+    for (Buffer& buffer : buffers)
+    {
+        for (void* block : buffer.overflowBlocks) ::operator delete(block);
+    }
+}
+
+void core::FrameArena::NewFrame()
+{
+    highWaterMark = std::max(highWaterMark, GetUsed(buffers[current]));
+
+    current ^= 1;
+    Buffer &buffer = buffers[current];
+
+    for (void* block : buffer.overflowBlocks) ::operator delete(block);
+    buffer.overflowBlocks.clear();
+
+    // Grows the buffer to fit the whole frame it was last used for, the overflow is then only paid once
+    const std::size_t used = GetUsed(buffer);
+
+    if (used > buffer.capacity)
+    {
+        std::size_t capacity = std::max<std::size_t>(buffer.capacity, 1);
+        while (capacity < used) capacity *= 2;
+
+        buffer.data.reset(new char[capacity]);
+        buffer.capacity = capacity;
+    }
+
+    buffer.offset.store(0, std::memory_order_relaxed);
+    buffer.overflow.store(0, std::memory_order_relaxed);
+}
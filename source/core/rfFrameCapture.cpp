@@ -0,0 +1,448 @@
+#include "core/rfFrameCapture.hpp"
+#include <algorithm>
+#include <cstring>
+#include <rlgl.h>
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_43)
+#   if defined(__APPLE__)
+#       define GL_SILENCE_DEPRECATION
+#       include <OpenGL/gl3.h>
+#   else
+#       include "external/glad.h"  // Entry points loaded by raylib
+#   endif
+#   define RF_CAPTURE_PBO
+#endif
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    std::string GetFramePath(const std::string& pattern, uint32_t index, bool numbered)
+    {
+        if (pattern.find('%') != std::string::npos)
+        {
+            const int length = std::snprintf(nullptr, 0, pattern.c_str(), index);
+            if (length < 0) return pattern;
+
+            std::string path(static_cast<std::size_t>(length) + 1, '\0');
+            std::snprintf(path.data(), path.size(), pattern.c_str(), index);
+            path.pop_back();
+
+            return path;
+        }
+
+        if (!numbered) return pattern;
+
+        char suffix[16];
+        std::snprintf(suffix, sizeof(suffix), "_%05u", index);
+
+        const std::size_t dot = pattern.find_last_of('.');
+        const std::size_t slash = pattern.find_last_of("/\\");
+        const bool extension = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+
+        return extension ? pattern.substr(0, dot) + suffix + pattern.substr(dot) : pattern + suffix;
+    }
+
+    // Full range BT.601 (JPEG) conversion to planar 4:2:0, the rows of 'pixels' being from bottom to top
+    void ConvertYUV420(const uint8_t* pixels, int width, int height, std::vector<uint8_t>& planes)
+    {
+        const int chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+        planes.resize(static_cast<std::size_t>(width) * height + 2 * static_cast<std::size_t>(chromaWidth) * chromaHeight);
+
+        uint8_t *y = planes.data();
+        uint8_t *u = y + static_cast<std::size_t>(width) * height;
+        uint8_t *v = u + static_cast<std::size_t>(chromaWidth) * chromaHeight;
+
+        const auto row = [&](int r) { return pixels + static_cast<std::size_t>(height - 1 - r) * width * 4; };
+        const auto clamp = [](int value) { return static_cast<uint8_t>(std::min(value, 255)); };
+
+        for (int r = 0; r < height; r++)
+        {
+            const uint8_t *src = row(r);
+
+            for (int c = 0; c < width; c++, src += 4)
+            {
+                *y++ = static_cast<uint8_t>((77 * src[0] + 150 * src[1] + 29 * src[2] + 128) >> 8);
+            }
+        }
+
+        for (int r = 0; r < chromaHeight; r++)
+        {
+            const int rows = std::min(2, height - 2 * r);
+
+            for (int c = 0; c < chromaWidth; c++)
+            {
+                const int cols = std::min(2, width - 2 * c);
+                int red = 0, green = 0, blue = 0;
+
+                for (int i = 0; i < rows; i++)
+                {
+                    const uint8_t *src = row(2 * r + i) + 8 * c;
+
+                    for (int j = 0; j < cols; j++, src += 4)
+                    {
+                        red += src[0], green += src[1], blue += src[2];
+                    }
+                }
+
+                const int count = rows * cols;
+                red /= count, green /= count, blue /= count;
+
+                // Offset of 128 << 8 included so that the shifted values are never negative
+                *u++ = clamp((-43 * red - 85 * green + 128 * blue + 32896) >> 8);
+                *v++ = clamp((128 * red - 107 * green - 21 * blue + 32896) >> 8);
+            }
+        }
+    }
+
+}
+
+void core::FrameCapture::ReadPixels(const ::RenderTexture& target)
+{
+    const int width = target.texture.width, height = target.texture.height;
+    const std::size_t size = static_cast<std::size_t>(width) * height * 4;
+
+    // The renderer has ended its texture mode, but the batch of the caller may still hold draws to the target
+    rlDrawRenderBatchActive();
+
+#   if defined(RF_CAPTURE_PBO)
+
+        // The GPU is more than a ring behind, the oldest copy must be completed first
+        if (ringUsed == ring.size()) CompleteSlot(true);
+
+        Slot &slot = ring[ringHead];
+        if (slot.buffer == 0) glGenBuffers(1, &slot.buffer);
+
+        GLint previous = 0;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, target.id);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+
+        if (slot.capacity != size)
+        {
+            glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+            slot.capacity = size;
+        }
+
+        // Returns immediately, the copy is done by the GPU into the buffer
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previous));
+
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.output = output;
+        slot.width = width, slot.height = height;
+        slot.index = frameCount;
+
+        ringHead = (ringHead + 1) % ring.size();
+        ringUsed++;
+
+#   else
+
+        unsigned char *pixels = static_cast<unsigned char*>(rlReadTexturePixels(target.texture.id, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+        if (pixels == nullptr) return;
+
+        PendingFrame frame{ output, AcquireBuffer(size), width, height, frameCount };
+        std::memcpy(frame.pixels.data(), pixels, size);
+        MemFree(pixels);
+
+        QueueFrame(std::move(frame));
+
+#   endif
+}
+
+bool core::FrameCapture::CompleteSlot(bool wait)
+{
+#   if defined(RF_CAPTURE_PBO)
+
+        Slot &slot = ring[ringTail];
+        const GLsync fence = static_cast<GLsync>(slot.fence);
+
+        GLenum status = glClientWaitSync(fence, 0, 0);
+
+        if (status == GL_TIMEOUT_EXPIRED)
+        {
+            if (!wait) return false;
+            do status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            while (status == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(fence);
+        slot.fence = nullptr;
+
+        const std::size_t size = static_cast<std::size_t>(slot.width) * slot.height * 4;
+        PendingFrame frame{ std::move(slot.output), AcquireBuffer(size), slot.width, slot.height, slot.index };
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        const void *pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size), GL_MAP_READ_BIT);
+
+        if (pixels != nullptr)
+        {
+            std::memcpy(frame.pixels.data(), pixels, size);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        ringTail = (ringTail + 1) % ring.size();
+        ringUsed--;
+
+        if (pixels == nullptr)
+        {
+            TraceLog(LOG_WARNING, "FrameCapture::Capture() -> Unable to map the frame [%u], dropped", frame.index);
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        QueueFrame(std::move(frame));
+
+#   else
+
+        (void)wait;
+
+#   endif
+
+    return true;
+}
+
+std::vector<uint8_t> core::FrameCapture::AcquireBuffer(std::size_t size)
+{
+    std::vector<uint8_t> buffer;
+
+    {
+        std::scoped_lock lock(encodeMutex);
+
+        if (!buffers.empty())
+        {
+            buffer = std::move(buffers.back());
+            buffers.pop_back();
+        }
+    }
+
+    buffer.resize(size);
+    return buffer;
+}
+
+void core::FrameCapture::QueueFrame(PendingFrame frame)
+{
+    {
+        std::unique_lock lock(encodeMutex);
+
+        if (pendingFrames.size() >= maxPendingFrames)
+        {
+            if (dropFrames)
+            {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                buffers.push_back(std::move(frame.pixels));
+                return;
+            }
+
+            encodeCondition.wait(lock, [this]() { return pendingFrames.size() < maxPendingFrames; });
+        }
+
+        pendingFrames.push_back(std::move(frame));
+
+        if (!encoder.joinable())
+        {
+            encoder = std::thread(&FrameCapture::EncoderLoop, this);
+        }
+    }
+
+    encodeCondition.notify_all();
+}
+
+void core::FrameCapture::EncoderLoop()
+{
+    std::vector<uint8_t> planes;
+    std::unique_lock lock(encodeMutex);
+
+    while (true)
+    {
+        encodeCondition.wait(lock, [this]() { return stopEncoder || !pendingFrames.empty(); });
+        if (pendingFrames.empty()) return;
+
+        PendingFrame frame = std::move(pendingFrames.front());
+        pendingFrames.pop_front();
+        encoding = true;
+
+        lock.unlock();
+        encodeCondition.notify_all();   // Room for the frames waiting in QueueFrame()
+
+            Encode(frame, planes);
+            frame.output.reset();       // Closes the file after the last frame of its recording
+
+        lock.lock();
+
+        if (buffers.size() < maxPendingFrames) buffers.push_back(std::move(frame.pixels));
+
+        encoding = false;
+        encodeCondition.notify_all();
+    }
+}
+
+bool core::FrameCapture::Encode(PendingFrame& frame, std::vector<uint8_t>& planes)
+{
+    Output &out = *frame.output;
+    const std::size_t stride = static_cast<std::size_t>(frame.width) * 4;
+
+    switch (out.format)
+    {
+        case CaptureFormat::Png:
+        {
+            // Rows from top to bottom, as expected by the image
+            for (int top = 0, bottom = frame.height - 1; top < bottom; top++, bottom--)
+            {
+                std::swap_ranges(frame.pixels.begin() + top * stride, frame.pixels.begin() + (top + 1) * stride,
+                                 frame.pixels.begin() + bottom * stride);
+            }
+
+            const ::Image image = { frame.pixels.data(), frame.width, frame.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            const std::string path = GetFramePath(out.path, frame.index, out.numbered);
+
+            if (!ExportImage(image, path.c_str()))
+            {
+                TraceLog(LOG_WARNING, "FrameCapture::Encode() -> Unable to write the frame [%s]", path.c_str());
+                return false;
+            }
+
+            return true;
+        }
+
+        case CaptureFormat::Raw:
+        {
+            bool success = true;
+
+            for (int row = frame.height - 1; row >= 0 && success; row--)
+            {
+                success = std::fwrite(frame.pixels.data() + row * stride, 1, stride, out.file) == stride;
+            }
+
+            if (!success) TraceLog(LOG_WARNING, "FrameCapture::Encode() -> Unable to write the frame [%u] to [%s]", frame.index, out.path.c_str());
+            return success;
+        }
+
+        case CaptureFormat::Y4M:
+        {
+            if (!out.headerWritten)
+            {
+                std::fprintf(out.file, "YUV4MPEG2 W%d H%d F%u:1 Ip A1:1 C420jpeg\n", frame.width, frame.height, out.fps);
+                out.headerWritten = true;
+            }
+
+            ConvertYUV420(frame.pixels.data(), frame.width, frame.height, planes);
+
+            const bool success = std::fputs("FRAME\n", out.file) >= 0
+                && std::fwrite(planes.data(), 1, planes.size(), out.file) == planes.size();
+
+            if (!success) TraceLog(LOG_WARNING, "FrameCapture::Encode() -> Unable to write the frame [%u] to [%s]", frame.index, out.path.c_str());
+            return success;
+        }
+    }
+
+    return false;
+}
+
+/* PUBLIC */
+
+core::FrameCapture::FrameCapture(uint32_t ringSize)
+: ring(std::max(ringSize, 1u))
+{ }
+
+core::FrameCapture::~FrameCapture()
+{
+    Stop();
+
+    {
+        std::scoped_lock lock(encodeMutex);
+        stopEncoder = true;
+    }
+
+    encodeCondition.notify_all();
+    if (encoder.joinable()) encoder.join();
+
+#   if defined(RF_CAPTURE_PBO)
+        for (const Slot& slot : ring)
+        {
+            if (slot.buffer != 0) glDeleteBuffers(1, &slot.buffer);
+        }
+#   endif
+}
+
+bool core::FrameCapture::Start(const std::string& path, CaptureFormat format, uint32_t frames, uint32_t fps)
+{
+    Stop();
+
+    auto out = std::make_shared<Output>();
+    out->path = path, out->format = format, out->fps = std::max(fps, 1u);
+    out->numbered = frames != 1;
+
+    if (format != CaptureFormat::Png)
+    {
+        out->file = std::fopen(path.c_str(), "wb");
+
+        if (out->file == nullptr)
+        {
+            TraceLog(LOG_WARNING, "FrameCapture::Start() -> Unable to create the file [%s]", path.c_str());
+            return false;
+        }
+    }
+
+    output = std::move(out);
+    frameLimit = frames, frameCount = 0;
+    frameWidth = frameHeight = 0;
+
+    return true;
+}
+
+void core::FrameCapture::Stop()
+{
+    output.reset();
+    while (ringUsed > 0) CompleteSlot(true);
+}
+
+void core::FrameCapture::Capture(const ::RenderTexture& target)
+{
+    // The copies completed by the GPU are handed to the encoder, even once the recording is stopped
+    while (ringUsed > 0 && CompleteSlot(false)) { }
+
+    if (output == nullptr || target.id == 0) return;
+
+    const int width = target.texture.width, height = target.texture.height;
+
+    if (frameCount == 0)
+    {
+        frameWidth = width, frameHeight = height;
+    }
+    else if ((width != frameWidth || height != frameHeight) && output->format != CaptureFormat::Png)
+    {
+        // The videos have a fixed size (e.g. a change of the dynamic resolution)
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ReadPixels(target);
+
+    if (++frameCount == frameLimit)
+    {
+        output.reset(); // The frames in flight are completed by the next captures
+    }
+}
+
+void core::FrameCapture::Flush()
+{
+    while (ringUsed > 0) CompleteSlot(true);
+
+    std::unique_lock lock(encodeMutex);
+    encodeCondition.wait(lock, [this]() { return pendingFrames.empty() && !encoding; });
+}
+
+bool core::FrameCapture::IsEncoding()
+{
+    if (ringUsed > 0) return true;
+
+    std::scoped_lock lock(encodeMutex);
+    return encoding || !pendingFrames.empty();
+}
@@ -0,0 +1,131 @@
+#include "core/rfFrameLimiter.hpp"
+#include <raylib.h>
+#include <algorithm>
+#include <thread>
+#include <cmath>
+
+using namespace rf;
+
+/* FRAME TIME HISTOGRAM */
+
+void core::FrameTimeHistogram::Add(float ms)
+{
+    const uint32_t index = static_cast<uint32_t>(std::max(ms, 0.0f) / BucketWidth);
+    buckets[std::min(index, BucketCount - 1)]++;
+
+    min = (count == 0) ? ms : std::min(min, ms);
+    max = (count == 0) ? ms : std::max(max, ms);
+    sum += ms, count++;
+}
+
+void core::FrameTimeHistogram::Reset()
+{
+    buckets.fill(0);
+    count = 0, sum = 0.0;
+    min = max = 0.0f;
+}
+
+float core::FrameTimeHistogram::GetPercentile(float p) const
+{
+    if (count == 0) return 0.0f;
+
+    const uint64_t rank = static_cast<uint64_t>(std::ceil(std::clamp(p, 0.0f, 1.0f) * count));
+    uint64_t accumulated = 0;
+
+    for (uint32_t i = 0; i < BucketCount; i++)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= rank && accumulated > 0)
+        {
+            return (i == BucketCount - 1) ? max : (i + 1) * BucketWidth;
+        }
+    }
+
+    return max;
+}
+
+/* FRAME LIMITER - PRIVATE */
+
+bool core::FrameLimiter::IsPacedByVSync() const
+{
+    if (!vsyncAware || !IsWindowReady() || !IsWindowState(FLAG_VSYNC_HINT)) return false;
+
+    const int refreshRate = GetMonitorRefreshRate(GetCurrentMonitor());
+    return refreshRate > 0 && static_cast<uint32_t>(refreshRate) <= targetFPS + 1;
+}
+
+void core::FrameLimiter::SleepUntil(Clock::time_point time)
+{
+    using Seconds = std::chrono::duration<double>;
+
+    // Sleeps by 1ms slices while the remaining time exceeds the observed sleep inaccuracy (mean + stddev)
+    for (double remaining = Seconds(time - Clock::now()).count(); remaining > sleepEstimate;)
+    {
+        const Clock::time_point start = Clock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        const double observed = Seconds(Clock::now() - start).count();
+
+        remaining -= observed;
+
+        // Welford's online variance, restarted periodically to follow the changes of the system load
+        if (++sleepSamples > 1000) sleepSamples = 2, sleepM2 = 0.0;
+        const double delta = observed - sleepMean;
+        sleepMean += delta / sleepSamples;
+        sleepM2 += delta * (observed - sleepMean);
+        sleepEstimate = sleepMean + std::sqrt(sleepM2 / (sleepSamples - 1));
+    }
+
+    // Spins for the remaining fraction of millisecond
+    while (Clock::now() < time)
+    {
+        std::this_thread::yield();
+    }
+}
+
+/* FRAME LIMITER - PUBLIC */
+
+void core::FrameLimiter::SetTargetFPS(uint32_t fps)
+{
+    targetFPS = fps;
+    period = fps > 0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps)) : Clock::duration{};
+    started = false;
+}
+
+void core::FrameLimiter::Wait()
+{
+    Clock::time_point now = Clock::now();
+
+    if (!started)
+    {
+        lastFrame = now;
+        deadline = now + period;
+        started = true;
+        return;
+    }
+
+    if (period.count() > 0)
+    {
+        if (IsPacedByVSync())
+        {
+            // The swap has already waited for the vertical blank, a frame spanning more than one refresh is missed
+            const auto refresh = std::chrono::duration<double>(1.0 / GetMonitorRefreshRate(GetCurrentMonitor()));
+            if (now - lastFrame > 1.5 * refresh) missedDeadlines++;
+            deadline = now + period;
+        }
+        else if (now > deadline)
+        {
+            // Late frame, the pacing restarts from now rather than trying to catch up with shorter frames
+            missedDeadlines++;
+            deadline = now + period;
+        }
+        else
+        {
+            SleepUntil(deadline);
+            now = Clock::now();
+            deadline += period;
+        }
+    }
+
+    histogram.Add(std::chrono::duration<float, std::milli>(now - lastFrame).count());
+    lastFrame = now;
+}
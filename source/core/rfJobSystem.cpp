@@ -0,0 +1,233 @@
+#include "core/rfJobSystem.hpp"
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    // Index of the worker running on this thread and the system it belongs to
+    thread_local int workerIndex = -1;
+    thread_local const core::JobSystem* workerOwner = nullptr;
+
+}
+
+void core::JobSystem::WorkerLoop(uint32_t index)
+{
+    workerIndex = static_cast<int>(index);
+    workerOwner = this;
+
+    Job job;
+
+    while (true)
+    {
+        if (Pop(job))
+        {
+            job();
+            job = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCondition.wait(lock, [this]() {
+            return pendingJobs.load(std::memory_order_acquire) > 0 || !running.load(std::memory_order_acquire);
+        });
+
+        if (!running && pendingJobs == 0) break;
+    }
+
+    workerIndex = -1;
+    workerOwner = nullptr;
+}
+
+void core::JobSystem::Push(Job&& job)
+{
+    WorkerQueue &queue = (workerOwner == this)
+        ? *queues[workerIndex] : sharedQueue;
+
+    {
+        std::scoped_lock lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+
+    pendingJobs.fetch_add(1, std::memory_order_release);
+
+    // Lock to not miss a worker about to sleep
+    { std::scoped_lock lock(sleepMutex); }
+    sleepCondition.notify_one();
+}
+
+bool core::JobSystem::Pop(Job& job)
+{
+    const bool isWorker = (workerOwner == this);
+    const uint32_t numQueues = static_cast<uint32_t>(queues.size());
+
+    // Own queue first, newest jobs are the hottest in cache
+    if (isWorker)
+    {
+        WorkerQueue &queue = *queues[workerIndex];
+        std::scoped_lock lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            pendingJobs.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+    }
+
+    // Then jobs submitted from outside the workers
+    {
+        std::scoped_lock lock(sharedQueue.mutex);
+        if (!sharedQueue.jobs.empty())
+        {
+            job = std::move(sharedQueue.jobs.front());
+            sharedQueue.jobs.pop_front();
+            pendingJobs.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+    }
+
+    // Finally steal the oldest job of another worker
+    const uint32_t start = isWorker ? workerIndex + 1 : 0;
+    for (uint32_t i = 0; i < numQueues; i++)
+    {
+        WorkerQueue &victim = *queues[(start + i) % numQueues];
+        std::scoped_lock lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            pendingJobs.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void core::JobSystem::Release(JobCounter& counter)
+{
+    std::vector<Job> continuations;
+
+    // The counter is only released under its lock so that Wait() and
+    // Run() never observe a counter that is still being modified
+    {
+        std::scoped_lock lock(counter.mutex);
+        if (counter.value.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        continuations.swap(counter.continuations);
+
+        // Notified under the lock, a blocked thread may destroy the counter as soon as it is released
+        counter.condition.notify_all();
+    }
+
+    for (auto& job : continuations)
+    {
+        if (workers.empty()) job();
+        else Push(std::move(job));
+    }
+}
+
+/* PUBLIC */
+
+core::JobSystem::JobSystem(uint32_t numWorkers)
+{
+#   ifndef PLATFORM_WEB
+        if (numWorkers == 0)
+        {
+            const uint32_t hwThreads = std::thread::hardware_concurrency();
+            numWorkers = hwThreads > 1 ? hwThreads - 1 : 1;
+        }
+
+        running = true;
+
+        queues.reserve(numWorkers);
+        for (uint32_t i = 0; i < numWorkers; i++)
+        {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        workers.reserve(numWorkers);
+        for (uint32_t i = 0; i < numWorkers; i++)
+        {
+            workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+        }
+#   endif
+}
+
+core::JobSystem::~JobSystem()
+{
+    Shutdown();
+}
+
+void core::JobSystem::Shutdown()
+{
+    {
+        std::scoped_lock lock(sleepMutex);
+        running = false;
+    }
+
+    sleepCondition.notify_all();
+
+    for (auto& worker : workers)
+    {
+        if (worker.joinable()) worker.join();
+    }
+
+    workers.clear();
+}
+
+int core::JobSystem::GetWorkerIndex()
+{
+    return workerIndex;
+}
+
+void core::JobSystem::Run(Job job, JobCounter* counter, JobCounter* dependency)
+{
+    if (counter != nullptr)
+    {
+        counter->value.fetch_add(1, std::memory_order_relaxed);
+        job = [this, job = std::move(job), counter]() { job(); Release(*counter); };
+    }
+
+    if (dependency != nullptr)
+    {
+        std::scoped_lock lock(dependency->mutex);
+        if (!dependency->IsDone())
+        {
+            dependency->continuations.push_back(std::move(job));
+            return;
+        }
+    }
+
+    if (workers.empty()) job();
+    else Push(std::move(job));
+}
+
+void core::JobSystem::Wait(const JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        if (!TryRunPending())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // Waits for the releasing thread to be done with the counter
+    std::scoped_lock lock(counter.mutex);
+}
+
+void core::JobSystem::Block(const JobCounter& counter)
+{
+    std::unique_lock<std::mutex> lock(counter.mutex);
+    counter.condition.wait(lock, [&counter]() { return counter.IsDone(); });
+}
+
+bool core::JobSystem::TryRunPending()
+{
+    Job job;
+    if (!Pop(job)) return false;
+    job();
+    return true;
+}
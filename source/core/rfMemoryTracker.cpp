@@ -0,0 +1,162 @@
+#include "core/rfMemoryTracker.hpp"
+#include <algorithm>
+#include <sstream>
+#include <fstream>
+#include <atomic>
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    constexpr std::size_t NumTags = static_cast<std::size_t>(core::MemoryTag::Count);
+
+    struct Counters
+    {
+        std::atomic<std::size_t> bytes{0};
+        std::atomic<std::size_t> peakBytes{0};
+        std::atomic<std::size_t> allocations{0};
+        std::atomic<std::size_t> totalAllocations{0};
+        std::atomic<std::size_t> frameAllocations{0};       // Of the current frame
+        std::atomic<std::size_t> lastFrameAllocations{0};   // Of the last completed frame
+    };
+
+    std::array<Counters, NumTags> counters;
+    std::atomic<std::size_t> totalPeakBytes{0};
+
+    void UpdatePeak(std::atomic<std::size_t>& peak, std::size_t value)
+    {
+        std::size_t current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed));
+    }
+
+    void WriteStats(std::ostringstream& json, const core::MemoryStats& stats)
+    {
+        json << "{ "
+             << "\"bytes\": " << stats.bytes << ", "
+             << "\"peakBytes\": " << stats.peakBytes << ", "
+             << "\"allocations\": " << stats.allocations << ", "
+             << "\"totalAllocations\": " << stats.totalAllocations << ", "
+             << "\"frameAllocations\": " << stats.frameAllocations << " }";
+    }
+
+}
+
+void core::MemoryTracker::Record(MemoryTag tag, std::size_t bytes)
+{
+    Counters &c = counters[static_cast<std::size_t>(tag)];
+
+    UpdatePeak(c.peakBytes, c.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    c.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    c.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void core::MemoryTracker::Release(MemoryTag tag, std::size_t bytes)
+{
+    Counters &c = counters[static_cast<std::size_t>(tag)];
+
+    c.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    c.allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/* PUBLIC */
+
+void core::MemoryTracker::NewFrame()
+{
+    if constexpr (!IsEnabled()) return;
+
+    std::size_t total = 0;
+
+    for (Counters& c : counters)
+    {
+        c.lastFrameAllocations.store(c.frameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        total += c.bytes.load(std::memory_order_relaxed);
+    }
+
+    UpdatePeak(totalPeakBytes, total);
+}
+
+core::MemoryStats core::MemoryTracker::GetStats(MemoryTag tag)
+{
+    const Counters &c = counters[static_cast<std::size_t>(tag)];
+
+    MemoryStats stats;
+    stats.bytes = c.bytes.load(std::memory_order_relaxed);
+    stats.peakBytes = c.peakBytes.load(std::memory_order_relaxed);
+    stats.allocations = c.allocations.load(std::memory_order_relaxed);
+    stats.totalAllocations = c.totalAllocations.load(std::memory_order_relaxed);
+    stats.frameAllocations = c.lastFrameAllocations.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+core::MemoryReport core::MemoryTracker::GetReport()
+{
+    MemoryReport report;
+
+    for (std::size_t i = 0; i < NumTags; i++)
+    {
+        const MemoryStats stats = GetStats(static_cast<MemoryTag>(i));
+        report.tags[i] = stats;
+
+        report.total.bytes += stats.bytes;
+        report.total.allocations += stats.allocations;
+        report.total.totalAllocations += stats.totalAllocations;
+        report.total.frameAllocations += stats.frameAllocations;
+    }
+
+    report.total.peakBytes = std::max(totalPeakBytes.load(std::memory_order_relaxed), report.total.bytes);
+
+    return report;
+}
+
+const char* core::MemoryTracker::GetTagName(MemoryTag tag)
+{
+    switch (tag)
+    {
+        case MemoryTag::General:    return "general";
+        case MemoryTag::Assets:     return "assets";
+        case MemoryTag::Sprites:    return "sprites";
+        case MemoryTag::Particles:  return "particles";
+        case MemoryTag::Physics:    return "physics";
+        case MemoryTag::Network:    return "network";
+        default:                    return "unknown";
+    }
+}
+
+/* MEMORY REPORT */
+
+std::string core::MemoryReport::ToJSON() const
+{
+    std::ostringstream json;
+
+    json << "{\n"
+         << "  \"enabled\": " << (MemoryTracker::IsEnabled() ? "true" : "false") << ",\n"
+         << "  \"total\": ";
+
+    WriteStats(json, total);
+    json << ",\n  \"tags\": {";
+
+    for (std::size_t i = 0; i < tags.size(); i++)
+    {
+        json << (i == 0 ? "\n" : ",\n")
+             << "    \"" << MemoryTracker::GetTagName(static_cast<MemoryTag>(i)) << "\": ";
+
+        WriteStats(json, tags[i]);
+    }
+
+    json << "\n  }\n}\n";
+
+    return json.str();
+}
+
+bool core::MemoryReport::Save(const std::string& fileName) const
+{
+    std::ofstream file(fileName);
+    if (!file.is_open()) return false;
+
+    file << ToJSON();
+    return !file.fail();
+}
@@ -0,0 +1,137 @@
+#include "core/rfMusicManager.hpp"
+#include <chrono>
+
+using namespace rf;
+
+namespace {
+
+    // Remaining time of the current track under which the next one is decoded ahead
+    constexpr float PreDecodeTime = 0.5f;
+
+    // Period of the streaming thread, shorter while waiting for the end of a track to follow it without gap
+    constexpr std::chrono::milliseconds StreamPeriod(10);
+    constexpr std::chrono::milliseconds EndOfTrackPeriod(1);
+
+}
+
+/* PRIVATE */
+
+void core::MusicManager::StartStreamer()
+{
+#   ifndef PLATFORM_WEB
+        if (!streamer.joinable())
+        {
+            streamer = std::thread(&MusicManager::StreamLoop, this);
+        }
+#   endif
+}
+
+void core::MusicManager::StreamLoop()
+{
+    std::unique_lock lock(mutex);
+
+    while (!stopStreamer)
+    {
+        UpdateStream();
+        streamCondition.wait_for(lock, nextMusic != nullptr ? EndOfTrackPeriod : StreamPeriod);
+    }
+}
+
+void core::MusicManager::UpdateStream()
+{
+    if (currentMusic == nullptr || !onPlaying) return;
+
+    raylib::Music &music = *currentMusic->second;
+    music.Update();
+
+    // Keeps the buffers of the track decoded ahead full, does nothing once they are
+    if (nextMusic != nullptr) nextMusic->second->Update();
+
+    // The stream loops by itself, without gap
+    if (looping) return;
+
+    // The stream stops by itself once its last frames have been played
+    if (music.IsPlaying() && music.GetTimePlayed() < music.GetTimeLength())
+    {
+        if (currentPlaylist != nullptr && nextMusic == nullptr && music.GetTimeLength() - music.GetTimePlayed() < PreDecodeTime)
+        {
+            PrepareNextMusic();
+        }
+
+        return;
+    }
+
+    // Handle track completion based on the playlist settings
+    if (nextMusic != nullptr)
+    {
+        // The next track is already decoded, resuming it is enough
+        currentMusic = nextMusic;
+        currentMusicIndex = nextMusicIndex;
+        nextMusic = nullptr;
+        nextMusicIndex = -1;
+
+        currentMusic->second->SetVolume(volume);
+        currentMusic->second->SetPitch(pitch);
+        currentMusic->second->SetPan(pan);
+        currentMusic->second->Resume();
+    }
+    else if (currentPlaylist != nullptr)
+    {
+        if (randomize) RandomMusic();
+        else NextMusic();
+    }
+    else
+    {
+        Stop();
+    }
+}
+
+void core::MusicManager::PrepareNextMusic()
+{
+    const int count = static_cast<int>(currentPlaylist->second.size());
+    int index = (currentMusicIndex + 1) % count;
+
+    if (randomize && count > 1)
+    {
+        do index = RandomIndex(count);
+        while (index == currentMusicIndex);
+    }
+
+    // The same stream cannot be decoded ahead while it is playing, it will be restarted at its end
+    Entry *entry = currentPlaylist->second[index];
+    if (entry == currentMusic) return;
+
+    nextMusic = entry;
+    nextMusicIndex = index;
+
+    // Paused right away so that the stream is filled but not mixed until the current track ends
+    raylib::Music &music = *entry->second;
+    music.SetLooping(false);
+    music.Play();
+    music.Pause();
+    music.Update();
+}
+
+void core::MusicManager::CancelNextMusic()
+{
+    if (nextMusic != nullptr)
+    {
+        nextMusic->second->Stop();
+        nextMusic = nullptr;
+        nextMusicIndex = -1;
+    }
+}
+
+/* PUBLIC */
+
+core::MusicManager::~MusicManager()
+{
+    {
+        std::scoped_lock lock(mutex);
+        stopStreamer = true;
+    }
+
+    streamCondition.notify_all();
+
+    if (streamer.joinable()) streamer.join();
+}
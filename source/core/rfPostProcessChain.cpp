@@ -0,0 +1,315 @@
+#include "core/rfPostProcessChain.hpp"
+#include <algorithm>
+#include <cctype>
+#include <rlgl.h>
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    bool IsIdentifierChar(char c)
+    {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    }
+
+    // Renames the function 'effect' of an effect so that several effects can live in the same shader
+    std::string RenameEffect(const std::string& source, const std::string& name)
+    {
+        constexpr char identifier[] = "effect";
+        constexpr std::size_t length = sizeof(identifier) - 1;
+
+        std::string result;
+        result.reserve(source.size() + 16);
+
+        std::size_t last = 0;
+
+        for (std::size_t pos = source.find(identifier); pos != std::string::npos; pos = source.find(identifier, pos + length))
+        {
+            const bool before = pos > 0 && IsIdentifierChar(source[pos - 1]);
+            const bool after = pos + length < source.size() && IsIdentifierChar(source[pos + length]);
+            if (before || after) continue;
+
+            result.append(source, last, pos - last).append(name);
+            last = pos + length;
+        }
+
+        return result.append(source, last, std::string::npos);
+    }
+
+}
+
+std::string core::PostProcessChain::GetHeader()
+{
+    static constexpr char uniforms[] =
+        "uniform sampler2D texture0;\n"
+        "uniform sampler2D sourceTexture;\n"
+        "uniform vec4 colDiffuse;\n"
+        "uniform vec2 texelSize;\n";
+
+    std::string header;
+
+    switch (rlGetVersion())
+    {
+        case RL_OPENGL_ES_20:
+            header = "#version 100\nprecision mediump float;\n";
+            [[fallthrough]];
+
+        case RL_OPENGL_21:
+            if (header.empty()) header = "#version 120\n";
+            header += "#define texture texture2D\n#define finalColor gl_FragColor\n";
+            header += "varying vec2 fragTexCoord;\nvarying vec4 fragColor;\n";
+            break;
+
+        case RL_OPENGL_ES_30:
+            header = "#version 300 es\nprecision mediump float;\n";
+            header += "in vec2 fragTexCoord;\nin vec4 fragColor;\nout vec4 finalColor;\n";
+            break;
+
+        default:
+            header = "#version 330\nin vec2 fragTexCoord;\nin vec4 fragColor;\nout vec4 finalColor;\n";
+            break;
+    }
+
+    return header + uniforms;
+}
+
+std::string core::PostProcessChain::GetFusedSource(const std::vector<const Pass*>& effects)
+{
+    std::string source = GetHeader();
+    std::string body = "void main()\n{\n    vec4 color = texture(texture0, fragTexCoord);\n";
+
+    for (std::size_t i = 0; i < effects.size(); i++)
+    {
+        const std::string name = "effect" + std::to_string(i);
+
+        source += "\n// " + effects[i]->name + "\n";
+        source += RenameEffect(effects[i]->source, name) + "\n";
+
+        body += "    color = " + name + "(color, fragTexCoord);\n";
+    }
+
+    return source + "\n" + body + "    finalColor = color*colDiffuse*fragColor;\n}\n";
+}
+
+bool core::PostProcessChain::LoadStage(Stage& stage, const std::string& source, const std::string& name)
+{
+    stage.shader = LoadShaderFromMemory(nullptr, source.c_str());
+
+    // raylib falls back to its default shader when the compilation fails
+    if (stage.shader.id == 0 || stage.shader.id == rlGetShaderIdDefault())
+    {
+        TraceLog(LOG_WARNING, "PostProcessChain::Build() -> Unable to compile the stage [%s], skipped", name.c_str());
+        return false;
+    }
+
+    stage.locTexelSize = GetShaderLocation(stage.shader, "texelSize");
+    stage.locSourceTexture = GetShaderLocation(stage.shader, "sourceTexture");
+
+    return true;
+}
+
+/* PUBLIC */
+
+uint32_t core::PostProcessChain::AddEffect(const std::string& name, const std::string& source, PostProcessScale scale)
+{
+    passes.push_back({ name, source, nullptr, scale, true, true });
+    dirty = true;
+
+    return static_cast<uint32_t>(passes.size() - 1);
+}
+
+uint32_t core::PostProcessChain::AddPass(const std::string& name, const std::string& fragmentSource, PostProcessScale scale)
+{
+    passes.push_back({ name, fragmentSource, nullptr, scale, false, true });
+    dirty = true;
+
+    return static_cast<uint32_t>(passes.size() - 1);
+}
+
+void core::PostProcessChain::SetUniforms(uint32_t pass, UniformSetter setter)
+{
+    if (pass >= passes.size()) return;
+    passes[pass].setUniforms = std::move(setter);
+}
+
+void core::PostProcessChain::SetEnabled(uint32_t pass, bool enabled)
+{
+    if (pass >= passes.size() || passes[pass].enabled == enabled) return;
+
+    passes[pass].enabled = enabled;
+    dirty = true;
+}
+
+void core::PostProcessChain::Clear()
+{
+    Unload();
+    passes.clear();
+}
+
+bool core::PostProcessChain::Build()
+{
+    Unload();
+    dirty = false;
+
+    bool success = true;
+
+    for (uint32_t i = 0; i < passes.size();)
+    {
+        const Pass &pass = passes[i];
+        if (!pass.enabled) { i++; continue; }
+
+        Stage stage{};
+        stage.scale = pass.scale;
+
+        if (!pass.effect)
+        {
+            const bool versioned = pass.source.find("#version") != std::string::npos;
+            stage.passes.push_back(i++);
+
+            if (LoadStage(stage, versioned ? pass.source : GetHeader() + pass.source, pass.name)) stages.push_back(std::move(stage));
+            else success = false;
+
+            continue;
+        }
+
+        // Consecutive effects of the same scale, disabled passes in between do not break the group
+        std::vector<const Pass*> effects;
+
+        for (; i < passes.size(); i++)
+        {
+            const Pass &next = passes[i];
+            if (!next.enabled) continue;
+            if (!next.effect || next.scale != stage.scale) break;
+
+            effects.push_back(&next);
+            stage.passes.push_back(i);
+        }
+
+        std::string name = effects.front()->name;
+        for (std::size_t j = 1; j < effects.size(); j++) name += " + " + effects[j]->name;
+
+        if (LoadStage(stage, GetFusedSource(effects), name)) stages.push_back(std::move(stage));
+        else success = false;
+    }
+
+    return success;
+}
+
+void core::PostProcessChain::Unload()
+{
+    for (const Stage& stage : stages)
+    {
+        UnloadShader(stage.shader);
+    }
+
+    stages.clear();
+    dirty = true;
+}
+
+void core::PostProcessChain::Apply(const Texture2D& texture, const Rectangle& source, const Rectangle& dest, Color tint, RenderTargetPool* pool)
+{
+    if (dirty) Build();
+
+    if (stages.empty())
+    {
+        DrawTexturePro(texture, source, dest, { 0, 0 }, 0, tint);
+        return;
+    }
+
+    RenderTargetPool &targets = pool ? *pool : ownPool;
+
+    // Two targets per scale, a stage never writes to the target it reads
+    ::RenderTexture pingPong[3][2]{};
+
+    Texture2D input = texture;
+    Rectangle inputRec = source;
+
+    for (std::size_t i = 0; i < stages.size(); i++)
+    {
+        const Stage &stage = stages[i];
+        const bool last = (i + 1 == stages.size());
+
+        ::RenderTexture *output = nullptr;
+
+        if (!last)
+        {
+            const int divisor = static_cast<int>(stage.scale);
+            const int level = (stage.scale == PostProcessScale::Full) ? 0 : (stage.scale == PostProcessScale::Half) ? 1 : 2;
+
+            output = &pingPong[level][pingPong[level][0].texture.id == input.id ? 1 : 0];
+
+            if (output->id == 0)
+            {
+                *output = targets.Acquire(std::max(1, texture.width / divisor), std::max(1, texture.height / divisor));
+
+                if (output->id == 0)
+                {
+                    DrawTexturePro(input, inputRec, dest, { 0, 0 }, 0, tint);
+                    break;
+                }
+            }
+
+            BeginTextureMode(*output);
+        }
+
+        BeginShaderMode(stage.shader);
+
+            if (stage.locTexelSize != -1)
+            {
+                const Vector2 texelSize = { 1.0f / input.width, 1.0f / input.height };
+                SetShaderValue(stage.shader, stage.locTexelSize, &texelSize, SHADER_UNIFORM_VEC2);
+            }
+
+            if (stage.locSourceTexture != -1)
+            {
+                SetShaderValueTexture(stage.shader, stage.locSourceTexture, texture);
+            }
+
+            for (uint32_t pass : stage.passes)
+            {
+                if (passes[pass].setUniforms) passes[pass].setUniforms(stage.shader);
+            }
+
+            if (last)
+            {
+                DrawTexturePro(input, inputRec, dest, { 0, 0 }, 0, tint);
+            }
+            else
+            {
+                // The intermediate results are written as is, without blending with the previous content
+                const Rectangle outputRec = { 0, 0, static_cast<float>(output->texture.width), static_cast<float>(output->texture.height) };
+
+                rlDisableColorBlend();
+                DrawTexturePro(input, inputRec, outputRec, { 0, 0 }, 0, WHITE);
+            }
+
+        EndShaderMode();
+
+        if (!last)
+        {
+            rlEnableColorBlend();
+            EndTextureMode();
+
+            input = output->texture;
+            inputRec = { 0, 0, static_cast<float>(input.width), -static_cast<float>(input.height) };
+        }
+    }
+
+    for (const auto& level : pingPong)
+    {
+        targets.Release(level[0]);
+        targets.Release(level[1]);
+    }
+
+    if (pool == nullptr)
+    {
+        ownPool.Collect();
+    }
+}
+
+bool core::PostProcessChain::IsEmpty() const
+{
+    return std::none_of(passes.begin(), passes.end(), [](const Pass& pass) { return pass.enabled; });
+}
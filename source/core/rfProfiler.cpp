@@ -0,0 +1,271 @@
+#include "core/rfProfiler.hpp"
+#include <algorithm>
+#include <fstream>
+#include <chrono>
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    std::atomic<uint64_t> profilerCounter{0};
+
+    int64_t SteadyNow()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void WriteEscaped(std::ofstream& file, std::string_view str)
+    {
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\') file << '\\';
+            file << c;
+        }
+    }
+
+}
+
+core::Profiler::ThreadBuffer& core::Profiler::GetThreadBuffer()
+{
+    // Releases the buffers of the thread for reuse when it exits
+    thread_local ThreadOwner owner;
+
+    if (owner.cached && owner.cached->profiler == id)
+    {
+        return *owner.cached;
+    }
+
+    // Buffer already used with this profiler, the buffers of destroyed profilers are dropped
+    for (auto it = owner.owned.begin(); it != owner.owned.end();)
+    {
+        if ((*it)->profiler == id) return *(owner.cached = it->get());
+        if (it->use_count() == 1) it = owner.owned.erase(it);
+        else ++it;
+    }
+
+    std::scoped_lock lock(mutex);
+
+    auto it = std::find_if(buffers.begin(), buffers.end(), [](const std::shared_ptr<ThreadBuffer>& buffer) {
+        return buffer->released.load(std::memory_order_acquire);
+    });
+
+    std::shared_ptr<ThreadBuffer> buffer;
+
+    if (it != buffers.end())
+    {
+        // Buffer of an exited thread, its unconsumed events are kept
+        buffer = *it;
+        buffer->released.store(false, std::memory_order_relaxed);
+    }
+    else
+    {
+        buffer = std::make_shared<ThreadBuffer>();
+        buffer->profiler = id;
+        buffer->tid = static_cast<uint32_t>(buffers.size());
+        buffers.push_back(buffer);
+    }
+
+    const bool isMain = std::this_thread::get_id() == mainThread;
+    buffer->name = isMain ? "Main" : "Thread " + std::to_string(buffer->tid);
+
+    owner.owned.push_back(buffer);
+    owner.cached = buffer.get();
+
+    return *buffer;
+}
+
+bool core::Profiler::ReadEvent(const ThreadBuffer& buffer, uint64_t index, Event& event)
+{
+    const Slot &slot = buffer.events[index & (BufferCapacity - 1)];
+
+    event.name = slot.name.load(std::memory_order_relaxed);
+    event.start = slot.start.load(std::memory_order_relaxed);
+    event.end = slot.end.load(std::memory_order_relaxed);
+
+    // Pairs with the fence of Record(), the event is valid if the owner has not started to overwrite it meanwhile
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return buffer.head.load(std::memory_order_relaxed) - index < BufferCapacity;
+}
+
+/* PUBLIC */
+
+core::Profiler::Profiler()
+: origin(SteadyNow()), id(++profilerCounter), mainThread(std::this_thread::get_id())
+{ }
+
+int64_t core::Profiler::Now() const
+{
+    return SteadyNow() - origin;
+}
+
+void core::Profiler::SetThreadName(const std::string& name)
+{
+    ThreadBuffer &buffer = GetThreadBuffer();
+    std::scoped_lock lock(mutex);
+    buffer.name = name;
+}
+
+void core::Profiler::Record(const char* name, int64_t start, int64_t end)
+{
+    ThreadBuffer &buffer = GetThreadBuffer();
+
+    const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+
+    // Orders the previous head before the overwrite, for the readers checking the head after reading (free on x86)
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Slot &slot = buffer.events[head & (BufferCapacity - 1)];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void core::Profiler::EndFrame()
+{
+    std::scoped_lock lock(mutex);
+
+    for (auto& buffer : buffers)
+    {
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+
+        // Events overwritten before being consumed are lost
+        if (head - buffer->tail > BufferCapacity)
+        {
+            buffer->tail = head - BufferCapacity;
+        }
+
+        for (; buffer->tail < head; buffer->tail++)
+        {
+            Event event;
+            if (!ReadEvent(*buffer, buffer->tail, event)) continue;
+
+            Series &s = series[event.name];
+            s.current += static_cast<float>(event.end - event.start) * 1e-6f;
+            s.touched = true;
+        }
+    }
+
+    frameCount++;
+
+    for (auto& [name, s] : series)
+    {
+        if (!s.touched) continue;
+        s.values[s.count++ % HistoryCapacity] = s.current;
+        s.current = 0, s.touched = false;
+        s.frame = frameCount;
+    }
+}
+
+void core::Profiler::ResetStats()
+{
+    std::scoped_lock lock(mutex);
+
+    for (auto& buffer : buffers)
+    {
+        buffer->tail = buffer->head.load(std::memory_order_acquire);
+    }
+
+    series.clear();
+}
+
+core::Profiler::Stats core::Profiler::GetStats(std::string_view name) const
+{
+    std::scoped_lock lock(mutex);
+
+    auto it = series.find(name);
+    if (it == series.end() || it->second.count == 0) return {};
+
+    const Series &s = it->second;
+    const uint32_t n = std::min(s.count, HistoryCapacity);
+
+    std::array<float, HistoryCapacity> sorted;
+    std::copy(s.values.begin(), s.values.begin() + n, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + n);
+
+    float sum = 0;
+    for (uint32_t i = 0; i < n; i++) sum += sorted[i];
+
+    Stats stats;
+    stats.min = sorted[0];
+    stats.avg = sum / n;
+    stats.p99 = sorted[std::min(n - 1, static_cast<uint32_t>(n * 0.99f))];
+    stats.last = s.values[(s.count - 1) % HistoryCapacity];
+    stats.samples = n;
+
+    return stats;
+}
+
+std::vector<std::pair<std::string_view, float>> core::Profiler::GetLastFrame() const
+{
+    std::scoped_lock lock(mutex);
+
+    std::vector<std::pair<std::string_view, float>> scopes;
+
+    for (const auto& [name, s] : series)
+    {
+        if (s.count == 0 || s.frame != frameCount) continue;
+        scopes.emplace_back(name, s.values[(s.count - 1) % HistoryCapacity]);
+    }
+
+    return scopes;
+}
+
+std::vector<std::string_view> core::Profiler::GetScopeNames() const
+{
+    std::scoped_lock lock(mutex);
+
+    std::vector<std::string_view> names;
+    names.reserve(series.size());
+
+    for (const auto& it : series)
+    {
+        names.push_back(it.first);
+    }
+
+    return names;
+}
+
+bool core::Profiler::DumpChromeTrace(const std::string& fileName) const
+{
+    std::ofstream file(fileName);
+    if (!file.is_open()) return false;
+
+    std::scoped_lock lock(mutex);
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    for (const auto& buffer : buffers)
+    {
+        // Thread name metadata
+        file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+             << buffer->tid << ",\"args\":{\"name\":\"";
+        WriteEscaped(file, buffer->name);
+        file << "\"}}";
+        first = false;
+
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        const uint64_t begin = head > BufferCapacity ? head - BufferCapacity : 0;
+
+        for (uint64_t i = begin; i < head; i++)
+        {
+            Event event;
+            if (!ReadEvent(*buffer, i, event)) continue;
+
+            file << ",\n{\"name\":\"";
+            WriteEscaped(file, event.name);
+            file << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid
+                 << ",\"ts\":" << event.start / 1000.0
+                 << ",\"dur\":" << (event.end - event.start) / 1000.0 << "}";
+        }
+    }
+
+    file << "\n]}\n";
+
+    return !file.fail();
+}
@@ -0,0 +1,255 @@
+#include "core/rfRandom.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#   define RF_RANDOM_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define RF_RANDOM_SSE2
+#endif
+
+using namespace rf;
+
+/* XOSHIRO256++ */
+
+void core::Xoshiro256pp::Jump()
+{
+    static constexpr uint64_t jump[4] = {
+        0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+        0xa9582618e03fc9aaull, 0x39abdc4529b1661cull
+    };
+
+    uint64_t t[4] = { 0, 0, 0, 0 };
+
+    for (uint64_t word : jump)
+    {
+        for (int bit = 0; bit < 64; bit++)
+        {
+            if (word & (1ull << bit))
+            {
+                for (int i = 0; i < 4; i++) t[i] ^= s[i];
+            }
+            (*this)();
+        }
+    }
+
+    std::memcpy(s, t, sizeof(s));
+}
+
+/* PCG64 */
+
+void core::Pcg64::Seed(uint64_t seed)
+{
+    const uint64_t initLo = SplitMix64(seed), initHi = SplitMix64(seed);
+    const uint64_t seqLo = SplitMix64(seed), seqHi = SplitMix64(seed);
+
+    // Same initialization as the reference pcg_setseq_128_srandom_r()
+    incHi = (seqHi << 1) | (seqLo >> 63);
+    incLo = (seqLo << 1) | 1;
+
+    stateLo = stateHi = 0;
+    Step();
+
+    stateLo += initLo;
+    stateHi += initHi + (stateLo < initLo);
+    Step();
+}
+
+void core::Pcg64::Advance(uint64_t deltaLo, uint64_t deltaHi)
+{
+    // Brown's algorithm, the LCG applied 'delta' times is itself an LCG computed by squaring
+    uint64_t accMulLo = 1, accMulHi = 0;
+    uint64_t accAddLo = 0, accAddHi = 0;
+    uint64_t curMulLo = MultiplierLo, curMulHi = MultiplierHi;
+    uint64_t curAddLo = incLo, curAddHi = incHi;
+
+    while (deltaLo | deltaHi)
+    {
+        if (deltaLo & 1)
+        {
+            MulAdd(accMulLo, accMulHi, curMulLo, curMulHi, 0, 0);
+            MulAdd(accAddLo, accAddHi, curMulLo, curMulHi, curAddLo, curAddHi);
+        }
+
+        // curAdd = (curMul + 1) * curAdd, curMul = curMul^2
+        uint64_t mulLo = curMulLo + 1, mulHi = curMulHi + (mulLo == 0);
+        MulAdd(curAddLo, curAddHi, mulLo, mulHi, 0, 0);
+        mulLo = curMulLo, mulHi = curMulHi;
+        MulAdd(curMulLo, curMulHi, mulLo, mulHi, 0, 0);
+
+        deltaLo = (deltaLo >> 1) | (deltaHi << 63);
+        deltaHi >>= 1;
+    }
+
+    MulAdd(stateLo, stateHi, accMulLo, accMulHi, accAddLo, accAddHi);
+}
+
+/* RANDOM LANES */
+
+void core::RandomLanes::Fill(float* values, std::size_t count, const float* min, const float* scale, int period)
+{
+    // Each step of the four streams gives eight floats, whose bounds repeat after 'period' steps
+    alignas(32) float mins[3][8], scales[3][8];
+
+    for (int phase = 0; phase < period; phase++)
+    {
+        for (int k = 0; k < 8; k++)
+        {
+            mins[phase][k] = min[(phase + k) % period];
+            scales[phase][k] = scale[(phase + k) % period];
+        }
+    }
+
+    int phase = 0;
+
+#   if defined(RF_RANDOM_AVX2)
+
+        __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[0]));
+        __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[1]));
+        __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[2]));
+        __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[3]));
+
+        const __m256i exponent = _mm256_set1_epi32(0x3f800000);
+        const __m256 one = _mm256_set1_ps(1.0f);
+
+        for (std::size_t i = 0; i < count; i += 8)
+        {
+            const __m256i sum = _mm256_add_epi64(s0, s3);
+            const __m256i result = _mm256_add_epi64(_mm256_or_si256(_mm256_slli_epi64(sum, 23), _mm256_srli_epi64(sum, 41)), s0);
+            const __m256i t = _mm256_slli_epi64(s1, 17);
+
+            s2 = _mm256_xor_si256(s2, s0);
+            s3 = _mm256_xor_si256(s3, s1);
+            s1 = _mm256_xor_si256(s1, s2);
+            s0 = _mm256_xor_si256(s0, s3);
+            s2 = _mm256_xor_si256(s2, t);
+            s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+
+            // The 23 high bits of each half as the mantissa of a float in [1, 2)
+            const __m256 unit = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_srli_epi32(result, 9), exponent)), one);
+            const __m256 value = _mm256_add_ps(_mm256_load_ps(mins[phase]), _mm256_mul_ps(unit, _mm256_load_ps(scales[phase])));
+
+            if (count - i >= 8)
+            {
+                _mm256_storeu_ps(values + i, value);
+            }
+            else
+            {
+                alignas(32) float tail[8];
+                _mm256_store_ps(tail, value);
+                std::memcpy(values + i, tail, (count - i) * sizeof(float));
+            }
+
+            phase = (phase + 8) % period;
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[0]), s0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[1]), s1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[2]), s2);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state[3]), s3);
+
+#   elif defined(RF_RANDOM_SSE2)
+
+        // Two pairs of lanes, the lanes 0 and 1 then the lanes 2 and 3
+        __m128i s[2][4];
+
+        for (int half = 0; half < 2; half++)
+        {
+            for (int word = 0; word < 4; word++)
+            {
+                s[half][word] = _mm_load_si128(reinterpret_cast<const __m128i*>(&state[word][2 * half]));
+            }
+        }
+
+        const __m128i exponent = _mm_set1_epi32(0x3f800000);
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        for (std::size_t i = 0; i < count; i += 8)
+        {
+            __m128 value[2];
+
+            for (int half = 0; half < 2; half++)
+            {
+                __m128i &s0 = s[half][0], &s1 = s[half][1], &s2 = s[half][2], &s3 = s[half][3];
+
+                const __m128i sum = _mm_add_epi64(s0, s3);
+                const __m128i result = _mm_add_epi64(_mm_or_si128(_mm_slli_epi64(sum, 23), _mm_srli_epi64(sum, 41)), s0);
+                const __m128i t = _mm_slli_epi64(s1, 17);
+
+                s2 = _mm_xor_si128(s2, s0);
+                s3 = _mm_xor_si128(s3, s1);
+                s1 = _mm_xor_si128(s1, s2);
+                s0 = _mm_xor_si128(s0, s3);
+                s2 = _mm_xor_si128(s2, t);
+                s3 = _mm_or_si128(_mm_slli_epi64(s3, 45), _mm_srli_epi64(s3, 19));
+
+                const __m128 unit = _mm_sub_ps(_mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(result, 9), exponent)), one);
+                value[half] = _mm_add_ps(_mm_load_ps(mins[phase] + 4 * half), _mm_mul_ps(unit, _mm_load_ps(scales[phase] + 4 * half)));
+            }
+
+            if (count - i >= 8)
+            {
+                _mm_storeu_ps(values + i, value[0]);
+                _mm_storeu_ps(values + i + 4, value[1]);
+            }
+            else
+            {
+                alignas(16) float tail[8];
+                _mm_store_ps(tail, value[0]);
+                _mm_store_ps(tail + 4, value[1]);
+                std::memcpy(values + i, tail, (count - i) * sizeof(float));
+            }
+
+            phase = (phase + 8) % period;
+        }
+
+        for (int half = 0; half < 2; half++)
+        {
+            for (int word = 0; word < 4; word++)
+            {
+                _mm_store_si128(reinterpret_cast<__m128i*>(&state[word][2 * half]), s[half][word]);
+            }
+        }
+
+#   else
+
+        const auto rotl = [](uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+
+        for (std::size_t i = 0; i < count; i += 8)
+        {
+            float value[8];
+
+            for (int lane = 0; lane < 4; lane++)
+            {
+                uint64_t &s0 = state[0][lane], &s1 = state[1][lane], &s2 = state[2][lane], &s3 = state[3][lane];
+
+                const uint64_t result = rotl(s0 + s3, 23) + s0;
+                const uint64_t t = s1 << 17;
+
+                s2 ^= s0;
+                s3 ^= s1;
+                s1 ^= s2;
+                s0 ^= s3;
+                s2 ^= t;
+                s3 = rotl(s3, 45);
+
+                // Low half first, as the little endian layout of the SIMD registers
+                for (int half = 0; half < 2; half++)
+                {
+                    const uint32_t bits = (static_cast<uint32_t>(result >> (32 * half)) >> 9) | 0x3f800000;
+                    float unit;
+                    std::memcpy(&unit, &bits, sizeof(float));
+
+                    const int k = 2 * lane + half;
+                    value[k] = mins[phase][k] + (unit - 1.0f) * scales[phase][k];
+                }
+            }
+
+            std::memcpy(values + i, value, std::min<std::size_t>(count - i, 8) * sizeof(float));
+            phase = (phase + 8) % period;
+        }
+
+#   endif
+}
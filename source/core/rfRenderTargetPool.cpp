@@ -0,0 +1,106 @@
+#include "core/rfRenderTargetPool.hpp"
+#include <rlgl.h>
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    ::RenderTexture LoadTarget(int width, int height, int format)
+    {
+        if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        {
+            return LoadRenderTexture(width, height);
+        }
+
+        // Same layout as LoadRenderTexture() (depth renderbuffer) so that UnloadRenderTexture() applies
+        ::RenderTexture target{};
+        target.id = rlLoadFramebuffer(width, height);
+        if (target.id == 0) return target;
+
+        rlEnableFramebuffer(target.id);
+
+        target.texture.id = rlLoadTexture(nullptr, width, height, format, 1);
+        target.texture.width = width, target.texture.height = height;
+        target.texture.format = format, target.texture.mipmaps = 1;
+
+        target.depth.id = rlLoadTextureDepth(width, height, true);
+        target.depth.width = width, target.depth.height = height;
+        target.depth.format = 19, target.depth.mipmaps = 1;
+
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+
+        const bool complete = rlFramebufferComplete(target.id);
+        rlDisableFramebuffer();
+
+        if (!complete)
+        {
+            TraceLog(LOG_WARNING, "RenderTargetPool::Acquire() -> Render target with format [%i] is not supported", format);
+            UnloadRenderTexture(target);
+            return ::RenderTexture{};
+        }
+
+        return target;
+    }
+
+}
+
+/* PUBLIC */
+
+::RenderTexture core::RenderTargetPool::Acquire(int width, int height, int format)
+{
+    for (auto it = available.begin(); it != available.end(); ++it)
+    {
+        const ::Texture &texture = it->target.texture;
+
+        if (texture.width == width && texture.height == height && texture.format == format)
+        {
+            const ::RenderTexture target = it->target;
+            *it = available.back();
+            available.pop_back();
+            acquiredCount++;
+            return target;
+        }
+    }
+
+    const ::RenderTexture target = LoadTarget(width, height, format);
+    if (target.id > 0) acquiredCount++;
+
+    return target;
+}
+
+void core::RenderTargetPool::Release(const ::RenderTexture& target)
+{
+    if (target.id == 0) return;
+
+    available.push_back({ target, frame });
+    if (acquiredCount > 0) acquiredCount--;
+}
+
+void core::RenderTargetPool::Collect()
+{
+    frame++;
+
+    for (std::size_t i = 0; i < available.size();)
+    {
+        if (frame - available[i].releaseFrame > maxIdleFrames)
+        {
+            UnloadRenderTexture(available[i].target);
+            available[i] = available.back();
+            available.pop_back();
+        }
+        else i++;
+    }
+}
+
+void core::RenderTargetPool::Clear()
+{
+    for (const Available& entry : available)
+    {
+        UnloadRenderTexture(entry.target);
+    }
+
+    available.clear();
+}
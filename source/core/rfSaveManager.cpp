@@ -0,0 +1,420 @@
+#include "core/rfSaveManager.hpp"
+#include <algorithm>
+#include <iterator>
+#include <cstdio>
+
+#if defined(_WIN32)
+#   define WIN32_LEAN_AND_MEAN
+#   define NOGDI
+#   define NOUSER
+#   include <windows.h>
+#   include <io.h>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#else
+#   include <unistd.h>
+#   include <fcntl.h>
+#endif
+
+using namespace rf;
+
+/* PRIVATE */
+
+namespace {
+
+    constexpr uint32_t JournalMagic = 0x4C4A4652;   // "RFJL"
+    constexpr uint32_t JournalFormat = 1;
+    constexpr std::size_t JournalBlock = 64;        // Granularity of the dirty regions
+
+    struct JournalHeader
+    {
+        uint32_t magic;
+        uint32_t format;
+        int32_t version;        // Version of the save data
+        uint32_t reserved;
+        uint64_t base;          // Hash of the save data of the snapshot the journal applies to
+    };
+
+    struct JournalRecord
+    {
+        uint64_t offset;
+        uint32_t length;
+        uint32_t checksum;      // Of the offset, length and payload
+    };
+
+    uint64_t Hash(const void* bytes, std::size_t size, uint64_t hash = 0xcbf29ce484222325ull)
+    {
+        // FNV-1a, same as AssetId
+        for (std::size_t i = 0; i < size; i++)
+        {
+            hash ^= static_cast<const uint8_t*>(bytes)[i];
+            hash *= 0x100000001b3ull;
+        }
+
+        return hash;
+    }
+
+    uint32_t Checksum(const JournalRecord& record, const char* payload)
+    {
+        uint64_t hash = Hash(&record.offset, sizeof(record.offset));
+        hash = Hash(&record.length, sizeof(record.length), hash);
+        hash = Hash(payload, record.length, hash);
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+
+}
+
+int core::SaveManager::WriteFileAtomic(const std::string& path, const std::vector<char>& buffer)
+{
+    const std::string tmpPath = path + ".tmp";
+
+#   if defined(_WIN32)
+
+        const int fd = _open(tmpPath.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+        if (fd < 0) return FILE_NOT_FOUND;
+
+        const bool written = _write(fd, buffer.data(), static_cast<unsigned int>(buffer.size())) == static_cast<int>(buffer.size())
+                          && _commit(fd) == 0;
+
+        _close(fd);
+
+        if (!written || !MoveFileExA(tmpPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        {
+            std::remove(tmpPath.c_str());
+            return WRITE_FAILURE;
+        }
+
+#   else
+
+        const int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return FILE_NOT_FOUND;
+
+        bool written = true;
+
+        for (std::size_t offset = 0; written && offset < buffer.size();)
+        {
+            const ssize_t count = ::write(fd, buffer.data() + offset, buffer.size() - offset);
+            if (count > 0) offset += static_cast<std::size_t>(count);
+            else written = false;
+        }
+
+        written = written && ::fsync(fd) == 0;
+        ::close(fd);
+
+        if (!written || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tmpPath.c_str());
+            return WRITE_FAILURE;
+        }
+
+        // Makes the rename itself durable
+        const std::size_t slash = path.find_last_of('/');
+        const std::string dirPath = (slash == std::string::npos) ? "." : path.substr(0, slash + 1);
+
+        const int dirFd = ::open(dirPath.c_str(), O_RDONLY);
+        if (dirFd >= 0)
+        {
+            ::fsync(dirFd);
+            ::close(dirFd);
+        }
+
+#   endif
+
+    return SUCCESS;
+}
+
+int core::SaveManager::AppendFile(const std::string& path, const std::vector<char>& buffer)
+{
+#   if defined(_WIN32)
+
+        const int fd = _open(path.c_str(), _O_WRONLY | _O_APPEND | _O_BINARY);
+        if (fd < 0) return FILE_NOT_FOUND;
+
+        const bool written = _write(fd, buffer.data(), static_cast<unsigned int>(buffer.size())) == static_cast<int>(buffer.size())
+                          && _commit(fd) == 0;
+
+        _close(fd);
+
+#   else
+
+        const int fd = ::open(path.c_str(), O_WRONLY | O_APPEND);
+        if (fd < 0) return FILE_NOT_FOUND;
+
+        bool written = true;
+
+        for (std::size_t offset = 0; written && offset < buffer.size();)
+        {
+            const ssize_t count = ::write(fd, buffer.data() + offset, buffer.size() - offset);
+            if (count > 0) offset += static_cast<std::size_t>(count);
+            else written = false;
+        }
+
+        written = written && ::fdatasync(fd) == 0;
+        ::close(fd);
+
+#   endif
+
+    // A partially appended record is discarded by its checksum when the journal is replayed
+    return written ? SUCCESS : WRITE_FAILURE;
+}
+
+void core::SaveManager::QueueWrite(PendingWrite write, WriteCallback callback)
+{
+    {
+        std::scoped_lock lock(writeMutex);
+
+        // Only the last pending write of a save can absorb the new one, so that its snapshot
+        // and its journal are always written in the order they were requested
+        auto it = std::find_if(pendingWrites.rbegin(), pendingWrites.rend(),
+            [&write](const PendingWrite& pending) { return pending.save == write.save; });
+
+        if (it != pendingWrites.rend() && it->path == write.path && it->append == write.append)
+        {
+            if (write.append)
+            {
+                it->buffer.insert(it->buffer.end(), write.buffer.begin(), write.buffer.end());
+            }
+            else
+            {
+                it->buffer = std::move(write.buffer);
+                it->journal = std::move(write.journal);
+            }
+        }
+        else
+        {
+            pendingWrites.push_back(std::move(write));
+            it = pendingWrites.rbegin();
+        }
+
+        if (callback) it->callbacks.push_back(std::move(callback));
+
+        if (!writer.joinable())
+        {
+            writer = std::thread(&SaveManager::WriterLoop, this);
+        }
+    }
+
+    writeCondition.notify_all();
+}
+
+void core::SaveManager::FlushSave(const std::string& save)
+{
+    std::unique_lock lock(writeMutex);
+    writeCondition.wait(lock, [this, &save]() {
+        return !(writing && writingSave == save) && std::none_of(pendingWrites.begin(), pendingWrites.end(),
+            [&save](const PendingWrite& pending) { return pending.save == save; });
+    });
+}
+
+void core::SaveManager::WriterLoop()
+{
+    std::unique_lock lock(writeMutex);
+
+    while (true)
+    {
+        writeCondition.wait(lock, [this]() { return stopWriter || !pendingWrites.empty(); });
+        if (pendingWrites.empty()) return;
+
+        PendingWrite write = std::move(pendingWrites.front());
+        pendingWrites.erase(pendingWrites.begin());
+        writingSave = write.save;
+        writing = true;
+
+        lock.unlock();
+
+            int result = write.append ? AppendFile(write.path, write.buffer) : WriteFileAtomic(write.path, write.buffer);
+            if (result == SUCCESS && !write.journal.empty()) result = WriteFileAtomic(write.path + ".journal", write.journal);
+
+            for (const WriteCallback& callback : write.callbacks) callback(result);
+
+        lock.lock();
+
+        writing = false;
+        writeCondition.notify_all();
+    }
+}
+
+int core::SaveManager::Journal(const std::string& path, std::size_t size, bool async, WriteCallback callback)
+{
+    // A synchronous write must not append to a journal the writer thread is compacting
+    if (!async) FlushSave(path);
+
+    const char *bytes = static_cast<const char*>(data);
+    std::vector<char> records;
+
+    // The journal on disk can no longer be trusted after a failed write
+    if (journalFailed.exchange(false)) journalPath.clear();
+
+    if (journalPath == path && journalBase.size() == size)
+    {
+        const auto blockDirty = [&](std::size_t offset) {
+            return std::memcmp(bytes + offset, journalBase.data() + offset, std::min(JournalBlock, size - offset)) != 0;
+        };
+
+        for (std::size_t offset = 0; offset < size;)
+        {
+            if (!blockDirty(offset))
+            {
+                offset += JournalBlock;
+                continue;
+            }
+
+            // Extends the region over the following modified blocks
+            std::size_t end = offset + JournalBlock;
+            while (end < size && blockDirty(end)) end += JournalBlock;
+            end = std::min(end, size);
+
+            JournalRecord record{ offset, static_cast<uint32_t>(end - offset), 0 };
+            record.checksum = Checksum(record, bytes + offset);
+
+            const std::size_t position = records.size();
+            records.resize(position + sizeof(JournalRecord) + record.length);
+            std::memcpy(records.data() + position, &record, sizeof(JournalRecord));
+            std::memcpy(records.data() + position + sizeof(JournalRecord), bytes + offset, record.length);
+
+            std::memcpy(journalBase.data() + offset, bytes + offset, record.length);
+            offset = end;
+        }
+
+        if (records.empty())
+        {
+            if (callback) callback(SUCCESS);
+            return SUCCESS;
+        }
+    }
+
+    const bool compact = journalPath != path || journalSize + records.size() > (journalCompaction > 0 ? journalCompaction : size);
+
+    WriteCallback onWritten = [this, callback = std::move(callback)](int result) {
+        if (result != SUCCESS) journalFailed = true;
+        if (callback) callback(result);
+    };
+
+    if (!compact)
+    {
+        journalSize += records.size();
+
+        if (async)
+        {
+            QueueWrite({ path + ".journal", path, std::move(records), {}, {}, true }, std::move(onWritten));
+            return SUCCESS;
+        }
+
+        const int result = AppendFile(path + ".journal", records);
+        if (result != SUCCESS) journalPath.clear();
+
+        return result;
+    }
+
+    // Compaction, the new journal is only valid for the new snapshot, so that a crash between
+    // the two writes leaves the new snapshot with the old journal which is then ignored
+    const JournalHeader header{ JournalMagic, JournalFormat, version, 0, Hash(bytes, size) };
+    std::vector<char> journal(sizeof(JournalHeader));
+    std::memcpy(journal.data(), &header, sizeof(JournalHeader));
+
+    journalBase.assign(bytes, bytes + size);
+    journalPath = path;
+    journalSize = 0;
+
+    if (async)
+    {
+        QueueWrite({ path, path, Snapshot(size), std::move(journal), {}, false }, std::move(onWritten));
+        return SUCCESS;
+    }
+
+    int result = WriteFileAtomic(path, Snapshot(size));
+    if (result == SUCCESS) result = WriteFileAtomic(path + ".journal", journal);
+    if (result != SUCCESS) journalPath.clear();
+
+    return result;
+}
+
+void core::SaveManager::ReplayJournal(const std::string& path, std::size_t size)
+{
+    std::ifstream file(path + ".journal", std::ios::binary);
+    if (!file.is_open()) return;
+
+    char *bytes = static_cast<char*>(data);
+
+    // A journal written for another snapshot (e.g. left by a crash during a compaction) is ignored
+    JournalHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(JournalHeader))
+        || header.magic != JournalMagic || header.format != JournalFormat
+        || header.version != version || header.base != Hash(bytes, size))
+    {
+        return;
+    }
+
+    std::vector<char> payload;
+    std::size_t replayed = 0;
+    bool torn = false;
+
+    while (true)
+    {
+        JournalRecord record{};
+
+        if (!file.read(reinterpret_cast<char*>(&record), sizeof(JournalRecord)))
+        {
+            torn = file.gcount() > 0;
+            break;
+        }
+
+        if (record.offset > size || record.length > size - record.offset)
+        {
+            torn = true;
+            break;
+        }
+
+        payload.resize(record.length);
+
+        if (!file.read(payload.data(), record.length) || Checksum(record, payload.data()) != record.checksum)
+        {
+            torn = true;
+            break;
+        }
+
+        std::memcpy(bytes + record.offset, payload.data(), record.length);
+        replayed += sizeof(JournalRecord) + record.length;
+    }
+
+    if (torn)
+    {
+        // The next journaled write compacts, rather than appending after the invalid records
+        TraceLog(LOG_WARNING, "SaveManager::Load() -> Journal [%s] ends with an invalid record, the following records are ignored", (path + ".journal").c_str());
+        return;
+    }
+
+    journalBase.assign(bytes, bytes + size);
+    journalPath = path;
+    journalSize = replayed;
+}
+
+/* PUBLIC */
+
+core::SaveManager::~SaveManager()
+{
+    {
+        std::scoped_lock lock(writeMutex);
+        stopWriter = true;
+    }
+
+    writeCondition.notify_all();
+
+    // The writer only exits once all the pending writes are done
+    if (writer.joinable()) writer.join();
+
+    operator delete(origin);
+    operator delete(data);
+}
+
+void core::SaveManager::Flush()
+{
+    std::unique_lock lock(writeMutex);
+    writeCondition.wait(lock, [this]() { return pendingWrites.empty() && !writing; });
+}
+
+bool core::SaveManager::IsWriting()
+{
+    std::scoped_lock lock(writeMutex);
+    return writing || !pendingWrites.empty();
+}
@@ -1,4 +1,5 @@
 #include "gfx2d/rfParticles.hpp"
+#include "core/rfMemoryTracker.hpp"
 #include <utility>
 #include <ctime>
 
@@ -24,11 +25,13 @@ gfx2d::ParticleSystem::ParticleSystem(uint32_t maxParticles)
     velYDistribution = std::uniform_real_distribution<float>(this->minVel.y, this->maxVel.y);
     radiusDistribution = std::uniform_real_distribution<float>(minRadius, maxRadius);
     particles = new Particle[maxParticles];
+    core::MemoryTracker::Allocate(core::MemoryTag::Particles, maxParticles * sizeof(Particle));
     numParticles = 0;
 }
 
 gfx2d::ParticleSystem::~ParticleSystem()
 {
+    if (particles) core::MemoryTracker::Free(core::MemoryTag::Particles, maxParticles * sizeof(Particle));
     delete[] particles;
     maxParticles = 0;
     numParticles = 0;
@@ -68,6 +71,10 @@ gfx2d::ParticleSystem& gfx2d::ParticleSystem::operator=(gfx2d::ParticleSystem&&
         velXDistribution = std::move(other.velXDistribution);
         velYDistribution = std::move(other.velYDistribution);
         radiusDistribution = std::move(other.radiusDistribution);
+
+        if (particles) core::MemoryTracker::Free(core::MemoryTag::Particles, maxParticles * sizeof(Particle));
+        delete[] particles;
+
         particles = std::exchange(other.particles, nullptr);
         maxParticles = std::exchange(other.maxParticles, 0);
         numParticles = std::exchange(other.numParticles, 0);
@@ -0,0 +1,349 @@
+#include <core/rfJobSystem.hpp>
+#include <core/rfAssetId.hpp>
+#include <core/rfCooked.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <filesystem>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <cctype>
+#include <atomic>
+#include <mutex>
+
+using namespace rf;
+namespace fs = std::filesystem;
+
+namespace {
+
+    constexpr uint64_t CookerVersion = 1;               ///< Bump to invalidate all the cached outputs.
+    constexpr const char* CacheFileName = ".rfcook";    ///< Manifest of the cooked sources, in the output directory.
+
+    /**
+     * @brief Per-file cooking options, read from an optional "<source>.cook" file next to the source.
+     *
+     * Supported lines:
+     *  - crop <x> <y> <width> <height>     Crops the image before mipmapping (sprite sheets...).
+     *  - mipmaps <on|off>                  Overrides the --mipmaps command line option.
+     */
+    struct Options
+    {
+        std::string text;               ///< Content of the options file, part of the content hash.
+        Rectangle crop{};               ///< Crop rectangle, ignored if empty.
+        bool mipmaps = false;           ///< Generates the mipmap chain of the images.
+    };
+
+    enum class Kind { Image, Model, Copy };
+
+    struct Item
+    {
+        fs::path source;                ///< Absolute path of the source.
+        std::string name;               ///< Path of the source relative to the input directory.
+        fs::path output;                ///< Path of the cooked file.
+        Kind kind;                      ///< What to do with the source.
+        Options options;                ///< Cooking options.
+        uint64_t hash;                  ///< Content hash of the source, its options and the cooker version.
+    };
+
+    std::string Lower(std::string str)
+    {
+        for (char& c : str) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        return str;
+    }
+
+    Kind GetKind(const fs::path& path)
+    {
+        static const char* images[] = { ".png", ".jpg", ".jpeg", ".bmp", ".tga", ".gif", ".qoi", ".hdr", ".psd" };
+        static const char* models[] = { ".obj", ".iqm", ".gltf", ".glb", ".vox", ".m3d" };
+
+        const std::string ext = Lower(path.extension().string());
+
+        for (const char* e : images) if (ext == e) return Kind::Image;
+        for (const char* e : models) if (ext == e) return Kind::Model;
+
+        return Kind::Copy;
+    }
+
+    bool ReadFile(const fs::path& path, std::string& content)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) return false;
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    bool WriteFile(const fs::path& path, const std::vector<unsigned char>& data)
+    {
+        fs::create_directories(path.parent_path());
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+        return file.good();
+    }
+
+    Options ParseOptions(const fs::path& source, bool defaultMipmaps)
+    {
+        Options options;
+        options.mipmaps = defaultMipmaps;
+
+        if (!ReadFile(source.string() + ".cook", options.text)) return options;
+
+        std::istringstream lines(options.text);
+        std::string line;
+
+        while (std::getline(lines, line))
+        {
+            std::istringstream tokens(line);
+            std::string key;
+            tokens >> key;
+
+            if (key == "crop")
+            {
+                tokens >> options.crop.x >> options.crop.y >> options.crop.width >> options.crop.height;
+            }
+            else if (key == "mipmaps")
+            {
+                std::string value;
+                tokens >> value;
+                options.mipmaps = (value == "on" || value == "1" || value == "true");
+            }
+        }
+
+        return options;
+    }
+
+    bool CookImageFile(const Item& item)
+    {
+        ::Image image = ::LoadImage(item.source.string().c_str());
+        if (!image.data) return false;
+
+        if (item.options.crop.width > 0 && item.options.crop.height > 0)
+        {
+            ImageCrop(&image, item.options.crop);
+        }
+
+        if (item.options.mipmaps)
+        {
+            ImageMipmaps(&image);
+        }
+
+        const bool success = WriteFile(item.output, core::CookImage(image));
+        UnloadImage(image);
+
+        return success;
+    }
+
+    bool CookModelFile(const Item& item)
+    {
+        // Loading a model uploads its meshes, a (hidden) window is therefore needed
+        if (!IsWindowReady())
+        {
+            SetConfigFlags(FLAG_WINDOW_HIDDEN);
+            InitWindow(1, 1, "rayflex_cook");
+            if (!IsWindowReady()) return false;
+        }
+
+        ::Model model = ::LoadModel(item.source.string().c_str());
+        if (model.meshCount == 0) return false;
+
+        const bool success = WriteFile(item.output, core::CookModel(model));
+        UnloadModel(model);
+
+        return success;
+    }
+
+    bool CopyFile(const Item& item)
+    {
+        std::error_code error;
+        fs::create_directories(item.output.parent_path(), error);
+        return fs::copy_file(item.source, item.output, fs::copy_options::overwrite_existing, error);
+    }
+
+    fs::path GetOutputPath(const fs::path& output, const std::string& name)
+    {
+        fs::path path = output / name;
+        const Kind kind = GetKind(path);
+
+        if (kind == Kind::Image) path.replace_extension(".rftex");
+        if (kind == Kind::Model) path.replace_extension(".rfmdl");
+
+        return path;
+    }
+
+    std::unordered_map<std::string, uint64_t> ReadCache(const fs::path& path)
+    {
+        std::unordered_map<std::string, uint64_t> cache;
+        std::ifstream file(path);
+        std::string line;
+
+        while (std::getline(file, line))
+        {
+            const std::size_t space = line.find(' ');
+            if (space == std::string::npos) continue;
+
+            // A corrupted line is skipped, its source is then cooked again
+            try
+            {
+                std::size_t end = 0;
+                const uint64_t hash = std::stoull(line.substr(0, space), &end, 16);
+                if (end == space) cache[line.substr(space + 1)] = hash;
+            }
+            catch (const std::logic_error&)
+            {
+                continue;
+            }
+        }
+
+        return cache;
+    }
+
+    void WriteCache(const fs::path& path, const std::unordered_map<std::string, uint64_t>& cache)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        for (const auto& [name, hash] : cache) file << std::hex << hash << ' ' << name << '\n';
+    }
+
+    int Usage(const char* program)
+    {
+        std::cerr << "Usage: " << program << " <input directory> <output directory> [--mipmaps] [--force]\n"
+                  << "  Converts images into raw pixel blobs (.rftex) and models into flattened buffers (.rfmdl),\n"
+                  << "  other files are copied as is. Only the sources whose content or options changed are cooked again,\n"
+                  << "  the outputs of the deleted sources are removed.\n"
+                  << "  Per-file options can be given in a '<source>.cook' file (crop <x> <y> <w> <h>, mipmaps <on|off>).\n";
+        return 1;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) return Usage(argv[0]);
+
+    bool mipmaps = false, force = false;
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--mipmaps") == 0) mipmaps = true;
+        else if (std::strcmp(argv[i], "--force") == 0) force = true;
+        else return Usage(argv[0]);
+    }
+
+    const fs::path input(argv[1]), output(argv[2]);
+
+    if (!fs::is_directory(input))
+    {
+        std::cerr << "Input directory [" << input.string() << "] not found\n";
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    const fs::path cachePath = output / CacheFileName;
+    std::unordered_map<std::string, uint64_t> cache = ReadCache(cachePath);
+
+    // Gathering of the sources that changed since the last run
+
+    std::vector<Item> items;
+    std::unordered_set<std::string> sources;
+    uint32_t upToDate = 0;
+
+    for (const auto& file : fs::recursive_directory_iterator(input))
+    {
+        if (!file.is_regular_file() || file.path().extension() == ".cook") continue;
+
+        Item item;
+        item.source = file.path();
+        item.name = fs::relative(file.path(), input).generic_string();
+        item.kind = GetKind(file.path());
+        item.options = ParseOptions(file.path(), mipmaps);
+        item.output = GetOutputPath(output, item.name);
+
+        sources.insert(item.name);
+
+        std::string content;
+        if (!ReadFile(item.source, content)) continue;
+
+        const std::string key = std::to_string(CookerVersion) + '\n'
+            + std::to_string(item.options.mipmaps) + '\n' + item.options.text;
+
+        item.hash = core::AssetId::Hash(content) ^ (core::AssetId::Hash(key) * 0x9E3779B97F4A7C15ull);
+
+        auto it = cache.find(item.name);
+        if (!force && it != cache.end() && it->second == item.hash && fs::exists(item.output))
+        {
+            upToDate++;
+            continue;
+        }
+
+        items.push_back(std::move(item));
+    }
+
+    // Images are decoded in parallel, models need the GL context and are cooked on the main thread
+
+    std::vector<char> results(items.size(), 0);
+
+    {
+        core::JobSystem jobSystem;
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(items.size()), [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++)
+            {
+                if (items[i].kind == Kind::Image) results[i] = CookImageFile(items[i]);
+                if (items[i].kind == Kind::Copy) results[i] = CopyFile(items[i]);
+            }
+        }, 1);
+    }
+
+    for (std::size_t i = 0; i < items.size(); i++)
+    {
+        if (items[i].kind == Kind::Model) results[i] = CookModelFile(items[i]);
+    }
+
+    if (IsWindowReady()) CloseWindow();
+
+    // Update of the cache with the successfully cooked sources only
+
+    uint32_t cooked = 0, failed = 0;
+
+    for (std::size_t i = 0; i < items.size(); i++)
+    {
+        if (results[i])
+        {
+            cache[items[i].name] = items[i].hash;
+            cooked++;
+        }
+        else
+        {
+            std::cerr << "Failed to cook [" << items[i].name << "]\n";
+            cache.erase(items[i].name);
+            failed++;
+        }
+    }
+
+    // Removal of the outputs whose source was deleted since the last run
+
+    uint32_t removed = 0;
+
+    for (auto it = cache.begin(); it != cache.end();)
+    {
+        if (sources.count(it->first))
+        {
+            ++it;
+            continue;
+        }
+
+        std::error_code error;
+        if (fs::remove(GetOutputPath(output, it->first), error)) removed++;
+
+        it = cache.erase(it);
+    }
+
+    fs::create_directories(output);
+    WriteCache(cachePath, cache);
+
+    std::cout << "Cooked " << cooked << " files, " << upToDate << " up to date, "
+              << removed << " removed, " << failed << " failed\n";
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,97 @@
+#include <core/rfAssetPack.hpp>
+#include <filesystem>
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cctype>
+
+using namespace rf;
+namespace fs = std::filesystem;
+
+namespace {
+
+    // Formats already compressed, deflating them again would only slow down their loading,
+    // and cooked formats, stored as is to be uploaded straight from the mapped pack
+    bool IsStoredFormat(const fs::path& path)
+    {
+        static const char* extensions[] = {
+            ".png", ".jpg", ".jpeg", ".qoi", ".dds", ".ktx", ".ktx2", ".pkm", ".astc",
+            ".ogg", ".mp3", ".flac", ".qoa", ".xm", ".mod", ".zip", ".rftex", ".rfmdl"
+        };
+
+        std::string ext = path.extension().string();
+        for (char& c : ext) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+        for (const char* compressed : extensions)
+        {
+            if (ext == compressed) return true;
+        }
+
+        return false;
+    }
+
+    int Usage(const char* program)
+    {
+        std::cerr << "Usage: " << program << " <output.rfpk> <input directory> [--no-compress | --compress-all]\n"
+                  << "  Packs all the files of the input directory, named by their path relative to it.\n"
+                  << "  By default, files in already compressed or cooked formats are stored as is and the others are deflated.\n";
+        return 1;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) return Usage(argv[0]);
+
+    enum { Auto, Never, Always } compress = Auto;
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--no-compress") == 0) compress = Never;
+        else if (std::strcmp(argv[i], "--compress-all") == 0) compress = Always;
+        else return Usage(argv[0]);
+    }
+
+    const fs::path input(argv[2]);
+
+    if (!fs::is_directory(input))
+    {
+        std::cerr << "Input directory [" << input.string() << "] not found\n";
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::vector<core::AssetPack::Source> sources;
+    std::size_t rawSize = 0;
+
+    for (const auto& file : fs::recursive_directory_iterator(input))
+    {
+        // Hidden files (such as the cache of rayflex_cook) are not packed
+        if (!file.is_regular_file() || file.path().filename().string()[0] == '.') continue;
+
+        std::ifstream stream(file.path(), std::ios::binary);
+
+        core::AssetPack::Source source;
+        source.name = fs::relative(file.path(), input).generic_string();
+        source.data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        source.compress = compress == Always || (compress == Auto && !IsStoredFormat(file.path()));
+
+        rawSize += source.data.size();
+        sources.push_back(std::move(source));
+    }
+
+    const std::size_t count = sources.size();
+
+    if (!core::AssetPack::Build(argv[1], std::move(sources)))
+    {
+        std::cerr << "Failed to write [" << argv[1] << "]\n";
+        return 1;
+    }
+
+    std::cout << "Packed " << count << " files (" << rawSize << " bytes) into [" << argv[1] << "] ("
+              << fs::file_size(argv[1]) << " bytes)\n";
+
+    return 0;
+}